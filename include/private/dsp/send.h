@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_DSP_SEND_H_
+#define PRIVATE_DSP_SEND_H_
+
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    /**
+     * DSP kernels specific for the send plugin
+     */
+    namespace send_dsp
+    {
+        /**
+         * Process the input signal in a single pass: apply output gain and store the result
+         * to the output buffer, apply send gain and store the result to the send buffer,
+         * and compute the absolute peak value of the input signal
+         *
+         * @param out output buffer, should not alias the input buffer
+         * @param send send buffer, may be NULL
+         * @param src input buffer
+         * @param k_out output gain
+         * @param k_send send gain
+         * @param count number of samples to process
+         * @return absolute peak value of the input signal
+         */
+        float process(float *out, float *send, const float *src, float k_out, float k_send, size_t count);
+
+        /**
+         * Same as process() but the output buffer is also the input buffer
+         *
+         * @param dst input and output buffer
+         * @param send send buffer, may be NULL
+         * @param k_out output gain
+         * @param k_send send gain
+         * @param count number of samples to process
+         * @return absolute peak value of the input signal
+         */
+        float process_inplace(float *dst, float *send, float k_out, float k_send, size_t count);
+
+        /**
+         * Process the input signal in a single pass and distribute it to multiple sends: apply
+         * output gain and store the result to the output buffer, apply individual gain of each
+         * send and store the result to the corresponding send buffer, and compute the absolute
+         * peak value of the input signal
+         *
+         * @param out output buffer, may alias the input buffer
+         * @param send list of send buffers, should not contain NULL elements
+         * @param src input buffer
+         * @param k_out output gain
+         * @param k_send list of send gains
+         * @param n_send number of sends
+         * @param count number of samples to process
+         * @return absolute peak value of the input signal
+         */
+        float fanout(float *out, float * const *send, const float *src, float k_out, const float *k_send, size_t n_send, size_t count);
+
+        /**
+         * Mix two input channels into two send channels with the 2x2 gain matrix in a single pass:
+         * dl = m[0]*l + m[1]*r, dr = m[2]*l + m[3]*r
+         *
+         * @param dl left send buffer, should not alias input buffers
+         * @param dr right send buffer, should not alias input buffers
+         * @param l left input buffer
+         * @param r right input buffer
+         * @param m gain matrix of four elements
+         * @param count number of samples to process
+         */
+        void matrix(float *dl, float *dr, const float *l, const float *r, const float *m, size_t count);
+
+        /**
+         * Mix the return signal into the dry signal in a single pass: out = dry*k_dry + ret*k_ret,
+         * and update absolute peak values of the dry, return and output signals
+         *
+         * @param out output buffer, may alias the dry or the return buffer
+         * @param dry dry signal buffer
+         * @param ret return signal buffer
+         * @param k_dry gain of the dry signal
+         * @param k_ret gain of the return signal
+         * @param peaks peak values of the dry, return and output signals to update
+         * @param count number of samples to process
+         */
+        void mix_return(float *out, const float *dry, const float *ret, float k_dry, float k_ret, float *peaks, size_t count);
+
+        /**
+         * Replace non-finite values (NaN and infinities) and denormal values with zeros and count them
+         *
+         * @param dst buffer to process
+         * @param nonfinite counter of non-finite values to increment
+         * @param denormal counter of denormal values to increment
+         * @param count number of samples to process
+         */
+        void sanitize(float *dst, size_t *nonfinite, size_t *denormal, size_t count);
+
+        /**
+         * Update the maximum of absolute values: dst[i] = max(dst[i], abs(src[i]))
+         *
+         * @param dst destination buffer
+         * @param src source buffer
+         * @param count number of samples to process
+         */
+        void abs_max2(float *dst, const float *src, size_t count);
+
+        /**
+         * Portable implementations of the kernels, the results are bit-exact to the optimized ones
+         */
+        namespace generic
+        {
+            float process(float *out, float *send, const float *src, float k_out, float k_send, size_t count);
+            float process_inplace(float *dst, float *send, float k_out, float k_send, size_t count);
+            float fanout(float *out, float * const *send, const float *src, float k_out, const float *k_send, size_t n_send, size_t count);
+            void matrix(float *dl, float *dr, const float *l, const float *r, const float *m, size_t count);
+            void mix_return(float *out, const float *dry, const float *ret, float k_dry, float k_ret, float *peaks, size_t count);
+            void sanitize(float *dst, size_t *nonfinite, size_t *denormal, size_t count);
+            void abs_max2(float *dst, const float *src, size_t count);
+        } /* namespace generic */
+
+    } /* namespace send_dsp */
+} /* namespace lsp */
+
+#endif /* PRIVATE_DSP_SEND_H_ */
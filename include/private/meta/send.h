@@ -25,6 +25,11 @@
 #include <lsp-plug.in/plug-fw/meta/types.h>
 #include <lsp-plug.in/plug-fw/const.h>
 
+// DSP load instrumentation, can be compiled out by defining LSP_SEND_PROFILING=0
+#ifndef LSP_SEND_PROFILING
+    #define LSP_SEND_PROFILING          1
+#endif /* LSP_SEND_PROFILING */
+
 namespace lsp
 {
     //-------------------------------------------------------------------------
@@ -37,11 +42,116 @@ namespace lsp
             static constexpr float  SEND_GAIN_MAX       = GAIN_AMP_P_60_DB;
             static constexpr float  SEND_GAIN_DFL       = GAIN_AMP_0_DB;
             static constexpr float  SEND_GAIN_STEP      = GAIN_AMP_S_0_5_DB;
+
+            static constexpr float  RETURN_GAIN_MIN     = GAIN_AMP_M_INF_DB;
+            static constexpr float  RETURN_GAIN_MAX     = GAIN_AMP_P_60_DB;
+            static constexpr float  RETURN_GAIN_DFL     = GAIN_AMP_0_DB;
+            static constexpr float  RETURN_GAIN_STEP    = GAIN_AMP_S_0_5_DB;
+
+            static constexpr float  DELAY_SAMPLES_MIN   = 0.0f;
+            static constexpr float  DELAY_SAMPLES_MAX   = 10000.0f;
+            static constexpr float  DELAY_SAMPLES_DFL   = 0.0f;
+            static constexpr float  DELAY_SAMPLES_STEP  = 1.0f;
+
+            static constexpr float  DELAY_TIME_MIN      = 0.0f;
+            static constexpr float  DELAY_TIME_MAX      = 250.0f;
+            static constexpr float  DELAY_TIME_DFL      = 0.0f;
+            static constexpr float  DELAY_TIME_STEP     = 0.01f;
+
+            static constexpr float  HPF_FREQ_MIN        = 10.0f;
+            static constexpr float  HPF_FREQ_MAX        = 20000.0f;
+            static constexpr float  HPF_FREQ_DFL        = 100.0f;
+            static constexpr float  HPF_FREQ_STEP       = 0.002f;
+
+            static constexpr float  LPF_FREQ_MIN        = 10.0f;
+            static constexpr float  LPF_FREQ_MAX        = 20000.0f;
+            static constexpr float  LPF_FREQ_DFL        = 10000.0f;
+            static constexpr float  LPF_FREQ_STEP       = 0.002f;
+
+            static constexpr float  GATE_THRESH_MIN     = GAIN_AMP_M_72_DB;
+            static constexpr float  GATE_THRESH_MAX     = GAIN_AMP_0_DB;
+            static constexpr float  GATE_THRESH_DFL     = GAIN_AMP_M_48_DB;
+            static constexpr float  GATE_THRESH_STEP    = GAIN_AMP_S_0_5_DB;
+
+            static constexpr float  GATE_ATTACK_MIN     = 0.1f;
+            static constexpr float  GATE_ATTACK_MAX     = 100.0f;
+            static constexpr float  GATE_ATTACK_DFL     = 5.0f;
+            static constexpr float  GATE_ATTACK_STEP    = 0.0025f;
+
+            static constexpr float  GATE_RELEASE_MIN    = 1.0f;
+            static constexpr float  GATE_RELEASE_MAX    = 2000.0f;
+            static constexpr float  GATE_RELEASE_DFL    = 100.0f;
+            static constexpr float  GATE_RELEASE_STEP   = 0.0025f;
+
+            static constexpr float  LUFS_MIN            = -72.0f;               // Minimum reported loudness (LUFS)
+            static constexpr float  LUFS_MAX            = 24.0f;                // Maximum reported loudness (LUFS)
+
+            static constexpr float  COUNTER_MAX         = 1000000.0f;           // Maximum reported value of event counters
+            static constexpr float  CONNECTIONS_MAX     = 16.0f;                // Maximum reported number of connected send channels
+
+            static constexpr float  BYPASS_TIME         = 0.005f;               // Bypass crossfade time (seconds)
+            static constexpr float  PROFILE_PERIOD      = 0.5f;                 // DSP load report period (seconds)
+            static constexpr float  PROFILE_TIME_MAX    = 100.0f;               // Maximum reported block processing time (ms)
+            static constexpr float  FILTER_TAIL         = 0.2f;                 // Time for send filters to ring out after the signal stops (seconds)
+            static constexpr float  GATE_KEY_RELEASE    = 0.01f;                // Release time of the send gate key envelope (seconds)
+            static constexpr float  LOUDNESS_RATE       = 24000.0f;             // Minimum sample rate of the decimated loudness meter input (Hz)
+            static constexpr float  LOUDNESS_BLOCK      = 0.1f;                 // Integration block of the loudness meter (seconds)
+            static constexpr size_t LOUDNESS_MOMENTARY  = 4;                    // Number of integration blocks of the momentary loudness
+            static constexpr size_t LOUDNESS_SHORT_TERM = 30;                   // Number of integration blocks of the short-term loudness
+            static constexpr size_t METER_HISTORY       = 0x400;                // Number of blocks kept in the meter history stream
+
+            enum delay_mode_t
+            {
+                DELAY_MODE_SAMPLES,
+                DELAY_MODE_TIME,
+
+                DELAY_MODE_DFL      = DELAY_MODE_SAMPLES
+            };
+
+            enum routing_t
+            {
+                ROUTING_STEREO,             // Left and right channels are sent as is
+                ROUTING_SWAP,               // Left and right channels are swapped
+                ROUTING_MONO,               // Mono sum is sent to both channels
+                ROUTING_MID_SIDE,           // Mid is sent to the left channel, side to the right channel
+                ROUTING_SIDE,               // Side is sent to both channels
+
+                ROUTING_DFL         = ROUTING_STEREO
+            };
+
+            enum connection_state_t
+            {
+                CONN_NONE,                  // None of the send channels is connected
+                CONN_PARTIAL,               // Some of the send channels are not connected
+                CONN_FULL                   // All send channels are connected
+            };
+
+            enum filter_slope_t
+            {
+                SLOPE_OFF,                  // Filter is disabled
+                SLOPE_12,                   // 12 dB/oct
+                SLOPE_24,                   // 24 dB/oct
+                SLOPE_36,                   // 36 dB/oct
+                SLOPE_48,                   // 48 dB/oct
+
+                SLOPE_DFL           = SLOPE_OFF
+            };
         } send;
 
         // Plugin type metadata
         extern const plugin_t send_mono;
         extern const plugin_t send_stereo;
+        extern const plugin_t sc_send_mono;
+        extern const plugin_t sc_send_stereo;
+        extern const plugin_t send_5_1;
+        extern const plugin_t send_7_1;
+        extern const plugin_t send_x16;
+        extern const plugin_t multisend_mono;
+        extern const plugin_t multisend_stereo;
+        extern const plugin_t sc_multisend_mono;
+        extern const plugin_t sc_multisend_stereo;
+        extern const plugin_t send_return_mono;
+        extern const plugin_t send_return_stereo;
 
     } /* namespace meta */
 } /* namespace lsp */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_PLUGINS_RETURN_H_
+#define PRIVATE_PLUGINS_RETURN_H_
+
+#include <lsp-plug.in/dsp-units/ctl/Bypass.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <private/meta/send.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        /**
+         * Return of the signal sent by the send plugin
+         */
+        class return_plugin: public plug::Module
+        {
+            private:
+                typedef struct channel_t
+                {
+                    dspu::Bypass        sBypass;        // Bypass
+                    float               vPeak[3];       // Peak levels of the input, return and output signals
+
+                    plug::IPort        *pIn;            // Input port
+                    plug::IPort        *pOut;           // Output port
+                    plug::IPort        *pReturn;        // Return port
+
+                    plug::IPort        *pInMeter;       // Input level meter
+                    plug::IPort        *pReturnMeter;   // Return level meter
+                    plug::IPort        *pOutMeter;      // Output level meter
+                } channel_t;
+
+            protected:
+                size_t              nChannels;          // Number of channels
+                channel_t          *vChannels;          // Channels
+                float              *vBuffer;            // Temporary buffer for the crossfade
+                float               fInGain;            // Input gain
+                float               fReturnGain;        // Return gain
+                float               fOutGain;           // Output gain
+                bool                bBypass;            // Bypass flag
+                size_t              nBypassFade;        // Length of the bypass crossfade in samples
+                size_t              nBypassTail;        // Number of samples left until bypass crossfade completes
+
+                plug::IPort        *pBypass;            // Bypass port
+                plug::IPort        *pInGain;            // Input gain
+                plug::IPort        *pOutGain;           // Output gain
+                plug::IPort        *pReturnGain;        // Return gain
+
+                uint8_t            *pData;              // Allocated data
+
+            protected:
+                void                do_destroy();
+
+            public:
+                explicit return_plugin(const meta::plugin_t *meta);
+                return_plugin(const return_plugin &) = delete;
+                return_plugin(return_plugin &&) = delete;
+                virtual ~return_plugin() override;
+
+                return_plugin & operator = (const return_plugin &) = delete;
+                return_plugin & operator = (return_plugin &&) = delete;
+
+                virtual void        init(plug::IWrapper *wrapper, plug::IPort **ports) override;
+                virtual void        destroy() override;
+
+            public:
+                virtual void        update_sample_rate(long sr) override;
+                virtual void        update_settings() override;
+                virtual void        process(size_t samples) override;
+                virtual void        dump(dspu::IStateDumper *v) const override;
+        };
+
+    } /* namespace plugins */
+} /* namespace lsp */
+
+
+#endif /* PRIVATE_PLUGINS_RETURN_H_ */
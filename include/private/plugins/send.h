@@ -24,7 +24,10 @@
 
 #include <lsp-plug.in/dsp-units/util/Delay.h>
 #include <lsp-plug.in/dsp-units/ctl/Bypass.h>
+#include <lsp-plug.in/dsp-units/filters/Equalizer.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
 #include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/runtime/system.h>
 #include <private/meta/send.h>
 
 namespace lsp
@@ -37,33 +40,206 @@ namespace lsp
         class send: public plug::Module
         {
             private:
-                typedef struct channel_t
+                typedef struct tap_t
                 {
                     dspu::Bypass        sBypass;        // Bypass
+                    dspu::Delay         sDelay;         // Latency compensation delay of the send
+                    dspu::Equalizer     sFilter;        // High-pass and low-pass filters of the send
+                    float              *pZero;          // Send buffer known to contain silence
+                    size_t              nZero;          // Number of silent samples from the start of the send buffer
+                    float               vKState[4];     // State of the K-weighting filter of the loudness meter
+                    core::AudioBuffer  *pSendBuf;       // Send buffer bound to the send port
+                    bool                bConnected;     // Send buffer is connected to the shared memory
+
+                    plug::IPort        *pSend;          // Send port
+                    plug::IPort        *pMeter;         // Send level meter
+                } tap_t;
+
+                typedef struct link_t
+                {
+                    float               fGain;          // Send gain
+                    float               fOldGain;       // Send gain applied at the end of the previous block
+                    size_t              nLatency;       // Latency of the return path to compensate
+                    size_t              nDelay;         // Delay of the send signal
+                    bool                bParked;        // Send is bypassed or muted and its buffer is just cleared
+                    bool                bMatrix;        // Send channels are mixed with the routing matrix
+                    bool                bRouted;        // Routing of the send differs from straight stereo
+                    bool                bFilter;        // Send filters are enabled
+                    size_t              nTail;          // Ring-out time of send filters in samples
+                    float               vMatrix[4];     // Routing matrix with the send gain applied
+                    float               vOldMatrix[4];  // Routing matrix applied at the end of the previous block
+                    float               fLoudSum;       // K-weighted energy of the current loudness block
+                    float               fRmsSum;        // Energy of the current loudness block
+                    size_t              nLoudCount;     // Number of samples in the current loudness block
+                    size_t              nLoudHead;      // Position of the next block in the loudness history
+                    float               vLoudHist[meta::send::LOUDNESS_SHORT_TERM]; // K-weighted energy of recent blocks
+                    float               vRmsHist[meta::send::LOUDNESS_MOMENTARY];   // Energy of recent blocks
+                    size_t              nConnected;     // Number of connected send channels
+
+                    plug::IPort        *pGain;          // Send gain port
+                    plug::IPort        *pRouting;       // Routing of the stereo send
+                    plug::IPort        *pHpfSlope;      // High-pass filter slope
+                    plug::IPort        *pHpfFreq;       // High-pass filter frequency
+                    plug::IPort        *pLpfSlope;      // Low-pass filter slope
+                    plug::IPort        *pLpfFreq;       // Low-pass filter frequency
+                    plug::IPort        *pDelaySamples;  // Latency compensation in samples
+                    plug::IPort        *pDelayTime;     // Latency compensation in milliseconds
+                    plug::IPort        *pSilent;        // Send silence indicator
+                    plug::IPort        *pConnState;     // Send connection state
+                    plug::IPort        *pRms;           // Send RMS level meter
+                    plug::IPort        *pMomentary;     // Send momentary loudness meter
+                    plug::IPort        *pShortTerm;     // Send short-term loudness meter
+                } link_t;
+
+                typedef struct channel_t
+                {
+                    dspu::Delay         sDelay;         // Latency compensation delay of the output
+                    size_t              nSilence;       // Number of consecutive silent input samples
+                    size_t              nNonFinite;     // Number of replaced non-finite samples
+                    size_t              nDenormal;      // Number of flushed denormal samples
+                    tap_t              *vTaps;          // Taps of the channel, one per send link
 
                     plug::IPort        *pIn;            // Input port
                     plug::IPort        *pOut;           // Output port
-                    plug::IPort        *pSend;          // Send port
+                    plug::IPort        *pSidechain;     // Sidechain input port
 
                     plug::IPort        *pInMeter;       // Input level meter
                     plug::IPort        *pOutMeter;      // Output level meter
-                    plug::IPort        *pSendMeter;     // Send level meter
+                    plug::IPort        *pNonFinite;     // Counter of replaced non-finite samples
+                    plug::IPort        *pDenormal;      // Counter of flushed denormal samples
                 } channel_t;
 
+                enum fast_state_t
+                {
+                    FAST_ACTIVE,                        // The only send is connected on all channels
+                    FAST_INACTIVE,                      // None of sends is connected
+                    FAST_BYPASS                         // Bypass has settled and all sends are parked
+                };
+
+                typedef void (send::*process_t)(size_t samples);
+
+            #if LSP_SEND_PROFILING
+                typedef struct profile_t
+                {
+                    uint64_t            nCalls;         // Number of processed blocks
+                    uint64_t            nSamples;       // Number of processed samples
+                    uint64_t            nTotal;         // Total processing time (ns)
+                    uint64_t            nMin;           // Minimum processing time of a block (ns)
+                    uint64_t            nMax;           // Maximum processing time of a block (ns)
+                } profile_t;
+            #endif /* LSP_SEND_PROFILING */
+
             protected:
                 size_t              nChannels;          // Number of channels
+                size_t              nLinks;             // Number of send links
                 channel_t          *vChannels;          // Channels
+                tap_t              *vTaps;              // Taps of all channels
+                link_t             *vLinks;             // Send links
+                const float       **vIn;                // Input buffers of all channels
+                float             **vOut;               // Output buffers of all channels
+                float             **vSend;              // Send buffers of all taps
+                float              *vPeak;              // Input peak levels of all channels
+                float             **vActive;            // List of active send buffers of the channel
+                float              *vActiveGain;        // List of gains of active send buffers of the channel
                 float               fInGain;            // Input gain
                 float               fOutGain;           // Output gain
-                float               fSendGain;          // Send gain
+                float               fOldOutGain;        // Output gain applied at the end of the previous block
+                bool                bBypass;            // Bypass flag
+                size_t              nBypassFade;        // Length of the bypass crossfade in samples
+                size_t              nBypassTail;        // Number of samples left until bypass crossfade completes
+                size_t              nBlockOffset;       // Offset of the processed chunk in the block
+                size_t              nBlockSize;         // Number of samples in the processed block
+                size_t              nDelay;             // Delay of the output signal
+                bool                bScrub;             // Sanitize send and output signals
+                bool                bGate;              // Send gate is enabled
+                bool                bSidechain;         // Plugin has sidechain inputs
+                bool                bGateSc;            // Send gate is keyed by the sidechain
+                float               fGateThresh;        // Send gate threshold
+                float               fGateAttack;        // Attack coefficient of the send gate
+                float               fGateRelease;       // Release coefficient of the send gate
+                float               fGateFall;          // Release coefficient of the send gate key envelope
+                float               fGateEnv;           // Envelope of the send gate key
+                float               fGateGain;          // Send gate gain at the end of the previous block
+                size_t              nGateClosed;        // Number of consecutive samples the send gate is fully closed
+                float              *vGate;              // Buffer for the key and the gain of the send gate
+                bool                bLoudness;          // Loudness metering is enabled
+                size_t              nLoudStep;          // Decimation factor of the loudness meter input
+                size_t              nLoudPhase;         // Position of the next decimated sample in the block
+                size_t              nLoudBlock;         // Number of decimated samples in the loudness block
+                float               vKCoeff[10];        // Coefficients of the K-weighting shelf and high-pass filters
+                size_t              nConnected;         // Number of connected send channels
+                size_t              nConnEvents;        // Number of send connection changes
+                process_t           pFast;              // Routine specialised for the configuration, NULL for generic path
 
                 plug::IPort        *pBypass;            // Bypass port
                 plug::IPort        *pInGain;            // Input gain
                 plug::IPort        *pOutGain;           // Output gain
-                plug::IPort        *pSendGain;          // Send gain
+                plug::IPort        *pDelayMode;         // Latency compensation mode
+                plug::IPort        *pReportLatency;     // Report latency compensation to the host
+                plug::IPort        *pScrub;             // Sanitize send and output signals
+                plug::IPort        *pGate;              // Send gate
+                plug::IPort        *pGateSc;            // Send gate is keyed by the sidechain
+                plug::IPort        *pGateThresh;        // Send gate threshold
+                plug::IPort        *pGateAttack;        // Send gate attack time
+                plug::IPort        *pGateRelease;       // Send gate release time
+                plug::IPort        *pGateMeter;         // Send gate gain meter
+                plug::IPort        *pLoudness;          // Loudness metering
+                plug::IPort        *pConnected;         // Number of connected send channels
+                plug::IPort        *pHistory;           // Meter history stream
+
+            #if LSP_SEND_PROFILING
+                profile_t           sProfile;           // DSP load statistics since the start
+                profile_t           sWindow;            // DSP load statistics since the last report
+                size_t              nProfilePeriod;     // DSP load report period in samples
+
+                plug::IPort        *pProfileMin;        // Minimum block processing time
+                plug::IPort        *pProfileAvg;        // Average block processing time
+                plug::IPort        *pProfileMax;        // Maximum block processing time
+            #endif /* LSP_SEND_PROFILING */
+
+                uint8_t            *pData;              // Allocated data for per-channel arrays
 
             protected:
                 void                do_destroy();
+                void                bind_sends();
+                void                sync_sends();
+                void                update_connections();
+                void                select_fast();
+                void                process_generic(bool ramp, size_t samples);
+                template <size_t CHANNELS, size_t STATE>
+                void                process_fast(size_t samples);
+                void                update_parking(size_t samples);
+                void                process_silence(channel_t *c, float **sends, size_t samples);
+                void                process_scrub(size_t samples);
+                void                update_gate(size_t offset, size_t samples);
+                void                process_gate(size_t samples);
+                const float        *gate_key(size_t channel) const;
+                void                update_loudness();
+                void                reset_loudness();
+                void                process_loudness(size_t samples);
+                void                output_loudness();
+                void                update_matrix(link_t *l);
+                void                update_filters(size_t link);
+                void                process_filters(size_t samples);
+                void                process_matrix(size_t link, bool fused, size_t samples);
+                float               process_ramp(size_t channel, float **sends, bool fused, size_t samples);
+                void                commit_gains();
+
+            #if LSP_SEND_PROFILING
+                void                update_profile(const system::time_t *start, size_t samples);
+            #endif /* LSP_SEND_PROFILING */
+
+            protected:
+                template <size_t CHANNELS>
+                static process_t    fast_routine(size_t state);
+                bool                send_zero(const tap_t *t, const float *send, size_t samples) const;
+                void                clear_send(tap_t *t, float *send, size_t samples);
+                static void         measure(tap_t *t, link_t *l, const float *k, const float *src, size_t step, size_t count);
+            #if LSP_SEND_PROFILING
+                static void         reset_profile(profile_t *p);
+                static void         account_profile(profile_t *p, uint64_t time, size_t samples);
+                static void         dump_profile(dspu::IStateDumper *v, const char *name, const profile_t *p);
+            #endif /* LSP_SEND_PROFILING */
 
             public:
                 explicit send(const meta::plugin_t *meta);
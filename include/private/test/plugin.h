@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIVATE_TEST_PLUGIN_H_
+#define PRIVATE_TEST_PLUGIN_H_
+
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/runtime/system.h>
+
+#include <string.h>
+
+namespace lsp
+{
+    /**
+     * Helpers for driving plugins from tests outside of the host
+     */
+    namespace send_test
+    {
+        /**
+         * In-memory port for driving the plugin outside of the host
+         */
+        class PluginPort: public plug::IPort
+        {
+            private:
+                float       fValue;
+                void       *pBuffer;
+
+            public:
+                explicit PluginPort(const meta::port_t *meta): IPort(meta)
+                {
+                    fValue      = meta->start;
+                    pBuffer     = NULL;
+                }
+
+            public:
+                virtual float value() override              { return fValue;        }
+                virtual void set_value(float value) override { fValue = value;       }
+                virtual void *buffer() override             { return pBuffer;       }
+
+            public:
+                inline void bind(void *buf)                 { pBuffer = buf;        }
+        };
+
+        /**
+         * Create the plugin through the registered factories
+         *
+         * @param uid unique identifier of the plugin
+         * @return plugin instance or NULL if there is no plugin with such identifier
+         */
+        inline plug::Module *create_plugin(const char *uid)
+        {
+            for (plug::Factory *f = plug::Factory::root(); f != NULL; f = f->next())
+            {
+                for (size_t i=0; ; ++i)
+                {
+                    const meta::plugin_t *meta = f->enumerate(i);
+                    if (meta == NULL)
+                        break;
+                    if (!strcmp(meta->uid, uid))
+                        return f->create(meta);
+                }
+            }
+
+            return NULL;
+        }
+
+        /**
+         * Get the current time
+         *
+         * @return current time in nanoseconds
+         */
+        inline uint64_t time_nanos()
+        {
+            system::time_t ts;
+            system::get_time(&ts);
+            return uint64_t(ts.seconds) * 1000000000 + ts.nanos;
+        }
+    } /* namespace send_test */
+} /* namespace lsp */
+
+#endif /* PRIVATE_TEST_PLUGIN_H_ */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PRIVATE_UI_SEND_H_
+#define PRIVATE_UI_SEND_H_
+
+#include <lsp-plug.in/lltl/darray.h>
+#include <lsp-plug.in/plug-fw/ui.h>
+
+namespace lsp
+{
+    namespace plugui
+    {
+        /**
+         * UI of the send plugin, level meters are driven by the meter history stream
+         */
+        class send_ui: public ui::Module, public ui::IPortListener
+        {
+            protected:
+                typedef struct meter_t
+                {
+                    tk::LedMeterChannel    *wMeter;         // Meter widget
+                    float                   fValue;         // Displayed level (dB)
+                    float                   fPeak;          // Displayed peak level (dB)
+                    float                   fHold;          // Time left until the peak starts to fall (seconds)
+                } meter_t;
+
+            protected:
+                ui::IPort              *pHistory;           // Meter history stream
+                lltl::darray<meter_t>   vMeters;            // Meters in the order of the history stream
+                uint32_t                nFrameId;           // Identifier of the last read frame
+                uint64_t                nLastTime;          // Time of the last meter update (ms)
+
+            protected:
+                void                    update_meters(plug::stream_t *s);
+
+            public:
+                explicit send_ui(const meta::plugin_t *meta);
+                send_ui(const send_ui &) = delete;
+                send_ui(send_ui &&) = delete;
+                virtual ~send_ui() override;
+
+                send_ui & operator = (const send_ui &) = delete;
+                send_ui & operator = (send_ui &&) = delete;
+
+                virtual status_t        post_init() override;
+                virtual void            destroy() override;
+
+            public:
+                virtual void            notify(ui::IPort *port, size_t flags) override;
+        };
+
+    } /* namespace plugui */
+} /* namespace lsp */
+
+
+#endif /* PRIVATE_UI_SEND_H_ */
@@ -10,6 +10,18 @@
 	It may be useful for inteacting between different DAWs, plugin formats or establish connection between
 	audio software when good straightforward way is not possible.
 </p>
+<p>
+	Besides mono and stereo versions, there are 5.1, 7.1 and 16-channel versions of the plugin which allow to send all
+	channels of the multichannel track to the single shared memory link.
+</p>
+<p>
+	Multi-Send versions of the plugin allow to send the signal to four shared memory links at once, each with it's own gain.
+	Links that are not connected do not consume any CPU resources.
+</p>
+<p>
+	Sidechain versions of the mono, stereo and Multi-Send plugins additionally have a sidechain input per channel
+	which can be used as the key of the send gate.
+</p>
 <p>
 	Note that transferring audio via the shared memory link may introduce some random latency, so it is important to not 
 	to consider that transmitter and receiver will be always sample-precise synchronized.
@@ -24,5 +36,21 @@
 	<li><b>Input</b> - the gain applied to the input signal.</li>
 	<li><b>Send</b> - the gain applied to the signal passed to the shared memory link.</li>
 	<li><b>Link</b> - the name of the shared memory link connection.</li>
+	<li><b>Connection</b> - the state of the shared memory link connection: 0 if no channel of the send is connected, 1 if only some channels are connected, 2 if all channels are connected. Sends which are not fully connected usually point to a missing or misspelled return.</li>
+	<li><b>Connected</b> - the number of send channels connected to the shared memory.</li>
 	<li><b>Output</b> - the gain applied to the output signal.</li>
+	<li><b>Routing</b> - the routing of the stereo send: <b>Stereo</b> sends left and right channels as is, <b>Swap</b> swaps them, <b>Mono</b> sends the mono sum to both channels, <b>Mid/Side</b> sends the mid signal to the left channel and the side signal to the right channel, <b>Side</b> sends only the side signal to both channels.</li>
+	<li><b>HPF slope</b>, <b>LPF slope</b> - the slope of the high-pass and the low-pass filter applied to the send signal only, the filter is disabled when the slope is <b>Off</b>.</li>
+	<li><b>HPF freq</b>, <b>LPF freq</b> - the cutoff frequency of the high-pass and the low-pass filter of the send signal.</li>
+	<li><b>Latency comp</b> - the mode of latency compensation: the latency of the return path is set either in samples or in milliseconds.</li>
+	<li><b>Comp samples</b>, <b>Comp time</b> - the latency of the signal path between the send and the corresponding return, the output and the other sends are delayed by the same amount to stay aligned.</li>
+	<li><b>Report latency</b> - report the latency compensation delay to the host as the plugin latency, so the host can compensate the delay of the output signal.</li>
+	<li><b>Sanitize</b> - replace NaN and infinite values with zeros and flush denormal values in the send and output signals. The number of replaced values of each channel is reported by the plugin.</li>
+	<li><b>Gate</b> - enable the gate of the send signal, the output signal is not affected by the gate. When the gate is fully closed, the send buffer is cleared once and the send is reported as silent.</li>
+	<li><b>Sidechain</b> - the gate is keyed by the sidechain input instead of the input signal, the key is the maximum of all channels. Available in the sidechain versions of the plugin only.</li>
+	<li><b>Gate thresh</b> - the level of the key which opens the gate.</li>
+	<li><b>Gate attack</b>, <b>Gate release</b> - the time of opening and closing the gate.</li>
+	<li><b>Loudness</b> - enable the loudness metering of the send signal. The plugin reports the RMS level over 400 ms, the momentary (400 ms) and the short-term (3 s) loudness in LUFS according to ITU-R BS.1770, the energy of all send channels is summed with equal weights.</li>
+	<li><b>Send 1</b> .. <b>Send 4</b> - the gain applied to the signal passed to the corresponding shared memory link of the Multi-Send plugin.</li>
+	<li><b>Link 1</b> .. <b>Link 4</b> - the name of the corresponding shared memory link connection of the Multi-Send plugin.</li>
 </ul>
@@ -0,0 +1,29 @@
+<?php
+	plugin_header();
+	$m      =   ($PAGE == 'send_return_mono') ? 'm' : 's';
+?>
+
+<p>
+	This is a plugin that allows to receive signal sent by the Send plugin via the special primitive - shared memory segment
+	(called 'shared memory link') and mix it into the signal of the track.
+</p>
+<p>
+	The signal is read directly from the shared memory link and mixed with the input signal in a single pass, so the return
+	does not require an additional copy of the received signal.
+</p>
+<p>
+	Note that transferring audio via the shared memory link may introduce some random latency, so it is important to not 
+	to consider that transmitter and receiver will be always sample-precise synchronized.
+</p>
+
+<p><b>Controls:</b></p>
+<ul>
+	<li>
+		<b>Bypass</b> - bypass switch, when turned on (led indicator is shining), the output signal is similar to input signal. That does not mean
+		that the plugin is not working.
+	</li>
+	<li><b>Input</b> - the gain applied to the input signal.</li>
+	<li><b>Return</b> - the gain applied to the signal received from the shared memory link.</li>
+	<li><b>Output</b> - the gain applied to the output signal.</li>
+	<li><b>Link</b> - the name of the shared memory link connection.</li>
+</ul>
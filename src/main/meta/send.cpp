@@ -42,53 +42,251 @@ namespace lsp
         //-------------------------------------------------------------------------
         // Plugin metadata
 
-        // NOTE: Port identifiers should not be longer than 7 characters as it will overflow VST2 parameter name buffers
-        static const port_t send_mono_ports[] =
+        static const port_item_t delay_modes[] =
+        {
+            { "Samples",        "send.delay.samples"    },
+            { "Time",           "send.delay.time"       },
+            { NULL, NULL }
+        };
+
+        static const port_item_t send_routings[] =
         {
-            PORTS_MONO_PLUGIN,
+            { "Stereo",         "send.routing.stereo"   },
+            { "Swap",           "send.routing.swap"     },
+            { "Mono",           "send.routing.mono"     },
+            { "Mid/Side",       "send.routing.mid_side" },
+            { "Side",           "send.routing.side"     },
+            { NULL, NULL }
+        };
 
-            BYPASS,
-            IN_GAIN,
-            OUT_GAIN,
-            LOG_CONTROL("g_send", "Send gain", "Send gain", U_GAIN_AMP, send::SEND_GAIN),
-            SEND_NAME("send", "Audio send connection point name"),
-            AUDIO_SEND("sout", "Audio send output", 0, "send"),
+        static const port_item_t filter_slopes[] =
+        {
+            { "Off",            "send.slope.off"        },
+            { "12 dB/oct",      "send.slope.12"         },
+            { "24 dB/oct",      "send.slope.24"         },
+            { "36 dB/oct",      "send.slope.36"         },
+            { "48 dB/oct",      "send.slope.48"         },
+            { NULL, NULL }
+        };
 
-            METER_GAIN("ilm", "Input level meter", GAIN_AMP_P_24_DB),
-            METER_GAIN("slm", "Send level meter", GAIN_AMP_P_24_DB),
-            METER_GAIN("olm", "Output level meter", GAIN_AMP_P_24_DB),
+        // Port templates, each channel is described as X(id, label, index, ...), each send link as X(id, label, ...)
+        #define SEND_AUDIO_INPUT(id, label, index, ...) \
+            AUDIO_INPUT("in" id, "Input" label),
+        #define SEND_AUDIO_OUTPUT(id, label, index, ...) \
+            AUDIO_OUTPUT("out" id, "Output" label),
+        #define SEND_AUDIO_SIDECHAIN(id, label, index, ...) \
+            AUDIO_INPUT("sc" id, "Sidechain input" label),
+        #define SEND_SIDECHAIN_NONE(channels)
+        #define SEND_SIDECHAIN(channels) \
+            channels(SEND_AUDIO_SIDECHAIN, 0) \
+            SWITCH("gsc", "Send gate is keyed by sidechain", "Gate sidechain", 0.0f),
+        #define SEND_AUDIO_SEND(id, label, index, lid, llabel) \
+            AUDIO_SEND("sout" lid id, "Audio send output" llabel label, index, "send" lid),
+        #define SEND_ROUTING_NONE(lid, llabel)
+        #define SEND_ROUTING_STEREO(lid, llabel) \
+            COMBO("smx" lid, "Send routing" llabel, "Routing" llabel, send::ROUTING_DFL, send_routings),
+        #define SEND_LINK(lid, llabel, channels, routing) \
+            LOG_CONTROL("g_send" lid, "Send gain" llabel, "Send gain" llabel, U_GAIN_AMP, send::SEND_GAIN), \
+            routing(lid, llabel) \
+            COMBO("hps" lid, "High-pass filter slope" llabel, "HPF slope" llabel, send::SLOPE_DFL, filter_slopes), \
+            LOG_CONTROL("hpf" lid, "High-pass filter frequency" llabel, "HPF freq" llabel, U_HZ, send::HPF_FREQ), \
+            COMBO("lps" lid, "Low-pass filter slope" llabel, "LPF slope" llabel, send::SLOPE_DFL, filter_slopes), \
+            LOG_CONTROL("lpf" lid, "Low-pass filter frequency" llabel, "LPF freq" llabel, U_HZ, send::LPF_FREQ), \
+            INT_CONTROL("lcs" lid, "Latency compensation samples" llabel, "Comp samples" llabel, U_SAMPLES, send::DELAY_SAMPLES), \
+            CONTROL("lct" lid, "Latency compensation time" llabel, "Comp time" llabel, U_MSEC, send::DELAY_TIME), \
+            SEND_NAME("send" lid, "Audio send connection point name" llabel), \
+            channels(SEND_AUDIO_SEND, lid, llabel) \
+            BLINK("sls" lid, "Send silence indicator" llabel), \
+            METER_MINMAX("scs" lid, "Send connection state" llabel, U_NONE, send::CONN_NONE, send::CONN_FULL), \
+            METER_GAIN("srm" lid, "Send RMS level meter" llabel, GAIN_AMP_P_24_DB), \
+            METER_MINMAX("slum" lid, "Send momentary loudness" llabel, U_LUFS, send::LUFS_MIN, send::LUFS_MAX), \
+            METER_MINMAX("slus" lid, "Send short-term loudness" llabel, U_LUFS, send::LUFS_MIN, send::LUFS_MAX),
+        #define SEND_LINK_METER(lid, llabel, id, label) \
+            METER_GAIN("slm" lid id, "Send level meter" llabel label, GAIN_AMP_P_24_DB),
+        #define SEND_COUNT(...) + 1
+        #define SEND_METERS(id, label, index, links) \
+            METER_GAIN("ilm" id, "Input level meter" label, GAIN_AMP_P_24_DB), \
+            links(SEND_LINK_METER, id, label) \
+            METER_GAIN("olm" id, "Output level meter" label, GAIN_AMP_P_24_DB), \
+            METER_MINMAX("snf" id, "Sanitized non-finite samples" label, U_NONE, 0.0f, send::COUNTER_MAX), \
+            METER_MINMAX("sdn" id, "Sanitized denormal samples" label, U_NONE, 0.0f, send::COUNTER_MAX),
 
+        #if LSP_SEND_PROFILING
+            #define SEND_PROFILE_PORTS \
+                METER_MINMAX("pmin", "Minimum block processing time", U_MSEC, 0.0f, send::PROFILE_TIME_MAX), \
+                METER_MINMAX("pavg", "Average block processing time", U_MSEC, 0.0f, send::PROFILE_TIME_MAX), \
+                METER_MINMAX("pmax", "Maximum block processing time", U_MSEC, 0.0f, send::PROFILE_TIME_MAX),
+        #else
+            #define SEND_PROFILE_PORTS
+        #endif /* LSP_SEND_PROFILING */
 
+        #define SEND_PORTS(channels, links, routing, sidechain) \
+            channels(SEND_AUDIO_INPUT, 0) \
+            channels(SEND_AUDIO_OUTPUT, 0) \
+            sidechain(channels) \
+            BYPASS, \
+            IN_GAIN, \
+            OUT_GAIN, \
+            COMBO("lcm", "Latency compensation mode", "Comp mode", send::DELAY_MODE_DFL, delay_modes), \
+            SWITCH("lcr", "Report latency compensation to host", "Report latency", 0.0f), \
+            SWITCH("scrub", "Sanitize send and output signals", "Sanitize", 0.0f), \
+            SWITCH("gate", "Send gate", "Gate", 0.0f), \
+            LOG_CONTROL("gth", "Send gate threshold", "Gate thresh", U_GAIN_AMP, send::GATE_THRESH), \
+            LOG_CONTROL("gat", "Send gate attack time", "Gate attack", U_MSEC, send::GATE_ATTACK), \
+            LOG_CONTROL("grl", "Send gate release time", "Gate release", U_MSEC, send::GATE_RELEASE), \
+            METER_GAIN("ggm", "Send gate gain meter", GAIN_AMP_0_DB), \
+            SWITCH("lmtr", "Send loudness metering", "Loudness", 0.0f), \
+            METER_MINMAX("scc", "Connected send channels", U_NONE, 0.0f, send::CONNECTIONS_MAX), \
+            links(SEND_LINK, channels, routing) \
+            channels(SEND_METERS, links) \
+            STREAM("mhist", "Meter history", (0 channels(SEND_COUNT, 0)) * (2 links(SEND_COUNT, 0)), \
+                send::METER_HISTORY, send::METER_HISTORY), \
+            SEND_PROFILE_PORTS \
             PORTS_END
-        };
+
+        #define RETURN_AUDIO_RETURN(id, label, index, ...) \
+            AUDIO_RETURN("rin" id, "Audio return input" label, index, "return"),
+        #define RETURN_METERS(id, label, index, ...) \
+            METER_GAIN("ilm" id, "Input level meter" label, GAIN_AMP_P_24_DB), \
+            METER_GAIN("rlm" id, "Return level meter" label, GAIN_AMP_P_24_DB), \
+            METER_GAIN("olm" id, "Output level meter" label, GAIN_AMP_P_24_DB),
+
+        #define RETURN_PORTS(channels) \
+            channels(SEND_AUDIO_INPUT, 0) \
+            channels(SEND_AUDIO_OUTPUT, 0) \
+            BYPASS, \
+            IN_GAIN, \
+            OUT_GAIN, \
+            LOG_CONTROL("g_ret", "Return gain", "Return gain", U_GAIN_AMP, send::RETURN_GAIN), \
+            RETURN_NAME("return", "Audio return connection point name"), \
+            channels(RETURN_AUDIO_RETURN, 0) \
+            channels(RETURN_METERS, 0) \
+            PORTS_END
+
+        // Send link layouts
+        #define SEND_LINKS_SINGLE(X, ...) \
+            X("", "", __VA_ARGS__)
+
+        #define SEND_LINKS_X4(X, ...) \
+            X("1", " 1", __VA_ARGS__) \
+            X("2", " 2", __VA_ARGS__) \
+            X("3", " 3", __VA_ARGS__) \
+            X("4", " 4", __VA_ARGS__)
+
+        // Channel layouts
+        #define SEND_CHANNELS_MONO(X, ...) \
+            X("", "", 0, __VA_ARGS__)
+
+        #define SEND_CHANNELS_STEREO(X, ...) \
+            X("_l", " Left", 0, __VA_ARGS__) \
+            X("_r", " Right", 1, __VA_ARGS__)
+
+        #define SEND_CHANNELS_5_1(X, ...) \
+            X("_1", " Left", 0, __VA_ARGS__) \
+            X("_2", " Right", 1, __VA_ARGS__) \
+            X("_3", " Center", 2, __VA_ARGS__) \
+            X("_4", " LFE", 3, __VA_ARGS__) \
+            X("_5", " Side Left", 4, __VA_ARGS__) \
+            X("_6", " Side Right", 5, __VA_ARGS__)
+
+        #define SEND_CHANNELS_7_1(X, ...) \
+            X("_1", " Left", 0, __VA_ARGS__) \
+            X("_2", " Right", 1, __VA_ARGS__) \
+            X("_3", " Center", 2, __VA_ARGS__) \
+            X("_4", " LFE", 3, __VA_ARGS__) \
+            X("_5", " Side Left", 4, __VA_ARGS__) \
+            X("_6", " Side Right", 5, __VA_ARGS__) \
+            X("_7", " Back Left", 6, __VA_ARGS__) \
+            X("_8", " Back Right", 7, __VA_ARGS__)
+
+        #define SEND_CHANNELS_X16(X, ...) \
+            X("_1", " 1", 0, __VA_ARGS__) \
+            X("_2", " 2", 1, __VA_ARGS__) \
+            X("_3", " 3", 2, __VA_ARGS__) \
+            X("_4", " 4", 3, __VA_ARGS__) \
+            X("_5", " 5", 4, __VA_ARGS__) \
+            X("_6", " 6", 5, __VA_ARGS__) \
+            X("_7", " 7", 6, __VA_ARGS__) \
+            X("_8", " 8", 7, __VA_ARGS__) \
+            X("_9", " 9", 8, __VA_ARGS__) \
+            X("_10", " 10", 9, __VA_ARGS__) \
+            X("_11", " 11", 10, __VA_ARGS__) \
+            X("_12", " 12", 11, __VA_ARGS__) \
+            X("_13", " 13", 12, __VA_ARGS__) \
+            X("_14", " 14", 13, __VA_ARGS__) \
+            X("_15", " 15", 14, __VA_ARGS__) \
+            X("_16", " 16", 15, __VA_ARGS__)
 
         // NOTE: Port identifiers should not be longer than 7 characters as it will overflow VST2 parameter name buffers
+        static const port_t send_mono_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_MONO, SEND_LINKS_SINGLE, SEND_ROUTING_NONE, SEND_SIDECHAIN_NONE)
+        };
+
+        static const port_t sc_send_mono_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_MONO, SEND_LINKS_SINGLE, SEND_ROUTING_NONE, SEND_SIDECHAIN)
+        };
+
         static const port_t send_stereo_ports[] =
         {
-            // Input and output audio ports
-            PORTS_STEREO_PLUGIN,
+            SEND_PORTS(SEND_CHANNELS_STEREO, SEND_LINKS_SINGLE, SEND_ROUTING_STEREO, SEND_SIDECHAIN_NONE)
+        };
 
-            BYPASS,
-            IN_GAIN,
-            OUT_GAIN,
-            LOG_CONTROL("g_send", "Send gain", "Send gain", U_GAIN_AMP, send::SEND_GAIN),
-            SEND_NAME("send", "Audio send connection point name"),
-            AUDIO_SEND("sout_l", "Audio send output left", 0, "send"),
-            AUDIO_SEND("sout_r", "Audio send output right", 1, "send"),
+        static const port_t sc_send_stereo_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_STEREO, SEND_LINKS_SINGLE, SEND_ROUTING_STEREO, SEND_SIDECHAIN)
+        };
 
-            METER_GAIN("ilm_l", "Input level meter Left", GAIN_AMP_P_24_DB),
-            METER_GAIN("slm_l", "Send level meter Left", GAIN_AMP_P_24_DB),
-            METER_GAIN("olm_l", "Output level meter Left", GAIN_AMP_P_24_DB),
-            METER_GAIN("ilm_r", "Input level meter Right", GAIN_AMP_P_24_DB),
-            METER_GAIN("slm_r", "Send level meter Right", GAIN_AMP_P_24_DB),
-            METER_GAIN("olm_r", "Output level meter Right", GAIN_AMP_P_24_DB),
+        static const port_t send_5_1_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_5_1, SEND_LINKS_SINGLE, SEND_ROUTING_NONE, SEND_SIDECHAIN_NONE)
+        };
 
-            PORTS_END
+        static const port_t send_7_1_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_7_1, SEND_LINKS_SINGLE, SEND_ROUTING_NONE, SEND_SIDECHAIN_NONE)
+        };
+
+        static const port_t send_x16_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_X16, SEND_LINKS_SINGLE, SEND_ROUTING_NONE, SEND_SIDECHAIN_NONE)
+        };
+
+        static const port_t multisend_mono_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_MONO, SEND_LINKS_X4, SEND_ROUTING_NONE, SEND_SIDECHAIN_NONE)
+        };
+
+        static const port_t sc_multisend_mono_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_MONO, SEND_LINKS_X4, SEND_ROUTING_NONE, SEND_SIDECHAIN)
+        };
+
+        static const port_t multisend_stereo_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_STEREO, SEND_LINKS_X4, SEND_ROUTING_STEREO, SEND_SIDECHAIN_NONE)
+        };
+
+        static const port_t sc_multisend_stereo_ports[] =
+        {
+            SEND_PORTS(SEND_CHANNELS_STEREO, SEND_LINKS_X4, SEND_ROUTING_STEREO, SEND_SIDECHAIN)
+        };
+
+        static const port_t send_return_mono_ports[] =
+        {
+            RETURN_PORTS(SEND_CHANNELS_MONO)
+        };
+
+        static const port_t send_return_stereo_ports[] =
+        {
+            RETURN_PORTS(SEND_CHANNELS_STEREO)
         };
 
         static const int plugin_classes[]       = { C_UTILITY, -1 };
         static const int clap_features_mono[]   = { CF_AUDIO_EFFECT, CF_UTILITY, CF_MONO, -1 };
         static const int clap_features_stereo[] = { CF_AUDIO_EFFECT, CF_UTILITY, CF_STEREO, -1 };
+        static const int clap_features_surround[] = { CF_AUDIO_EFFECT, CF_UTILITY, CF_SURROUND, -1 };
 
         const meta::bundle_t send_bundle =
         {
@@ -99,6 +297,15 @@ namespace lsp
             "This plugin allows to perform audio send using the shared memory."
         };
 
+        const meta::bundle_t send_return_bundle =
+        {
+            "send_return",
+            "Send Return",
+            B_UTILITIES,
+            NULL,
+            "This plugin allows to perform audio return using the shared memory."
+        };
+
         const plugin_t send_mono =
         {
             "Send Mono",
@@ -131,6 +338,38 @@ namespace lsp
         };
         LSP_REGISTER_METADATA(send_mono);
 
+        const plugin_t sc_send_mono =
+        {
+            "Sidechain Send Mono",
+            "Sidechain Send Mono",
+            "Sidechain Send Mono",
+            "SS1M",
+            &developers::v_sadovnikov,
+            "sc_send_mono",
+            {
+                LSP_LV2_URI("sc_send_mono"),
+                LSP_LV2UI_URI("sc_send_mono"),
+                "ss1m",
+                LSP_VST3_UID("ss1m    ss1m"),
+                LSP_VST3UI_UID("ss1m    ss1m"),
+                0,
+                NULL,
+                LSP_CLAP_URI("sc_send_mono"),
+                LSP_GST_UID("sc_send_mono"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_mono,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            sc_send_mono_ports,
+            "plugins/util/send.xml",
+            NULL,
+            mono_plugin_sidechain_port_groups,
+            &send_bundle,
+            2
+        };
+        LSP_REGISTER_METADATA(sc_send_mono);
+
         const plugin_t send_stereo =
         {
             "Send Stereo",
@@ -163,5 +402,325 @@ namespace lsp
         };
         LSP_REGISTER_METADATA(send_stereo);
 
+        const plugin_t sc_send_stereo =
+        {
+            "Sidechain Send Stereo",
+            "Sidechain Send Stereo",
+            "Sidechain Send Stereo",
+            "SS1S",
+            &developers::v_sadovnikov,
+            "sc_send_stereo",
+            {
+                LSP_LV2_URI("sc_send_stereo"),
+                LSP_LV2UI_URI("sc_send_stereo"),
+                "ss1s",
+                LSP_VST3_UID("ss1s    ss1s"),
+                LSP_VST3UI_UID("ss1s    ss1s"),
+                0,
+                NULL,
+                LSP_CLAP_URI("sc_send_stereo"),
+                LSP_GST_UID("sc_send_stereo"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_stereo,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            sc_send_stereo_ports,
+            "plugins/util/send.xml",
+            NULL,
+            stereo_plugin_sidechain_port_groups,
+            &send_bundle,
+            1
+        };
+        LSP_REGISTER_METADATA(sc_send_stereo);
+
+        const plugin_t send_5_1 =
+        {
+            "Send 5.1",
+            "Send 5.1",
+            "Send 5.1",
+            "S15",
+            &developers::v_sadovnikov,
+            "send_5_1",
+            {
+                LSP_LV2_URI("send_5_1"),
+                LSP_LV2UI_URI("send_5_1"),
+                "s015",
+                LSP_VST3_UID("s015    s015"),
+                LSP_VST3UI_UID("s015    s015"),
+                0,
+                NULL,
+                LSP_CLAP_URI("send_5_1"),
+                LSP_GST_UID("send_5_1"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_surround,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            send_5_1_ports,
+            "plugins/util/send.xml",
+            NULL,
+            NULL,
+            &send_bundle,
+            3
+        };
+        LSP_REGISTER_METADATA(send_5_1);
+
+        const plugin_t send_7_1 =
+        {
+            "Send 7.1",
+            "Send 7.1",
+            "Send 7.1",
+            "S17",
+            &developers::v_sadovnikov,
+            "send_7_1",
+            {
+                LSP_LV2_URI("send_7_1"),
+                LSP_LV2UI_URI("send_7_1"),
+                "s017",
+                LSP_VST3_UID("s017    s017"),
+                LSP_VST3UI_UID("s017    s017"),
+                0,
+                NULL,
+                LSP_CLAP_URI("send_7_1"),
+                LSP_GST_UID("send_7_1"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_surround,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            send_7_1_ports,
+            "plugins/util/send.xml",
+            NULL,
+            NULL,
+            &send_bundle,
+            4
+        };
+        LSP_REGISTER_METADATA(send_7_1);
+
+        const plugin_t send_x16 =
+        {
+            "Send x16",
+            "Send x16",
+            "Send x16",
+            "S16",
+            &developers::v_sadovnikov,
+            "send_x16",
+            {
+                LSP_LV2_URI("send_x16"),
+                LSP_LV2UI_URI("send_x16"),
+                "s016",
+                LSP_VST3_UID("s016    s016"),
+                LSP_VST3UI_UID("s016    s016"),
+                0,
+                NULL,
+                LSP_CLAP_URI("send_x16"),
+                LSP_GST_UID("send_x16"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_surround,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            send_x16_ports,
+            "plugins/util/send.xml",
+            NULL,
+            NULL,
+            &send_bundle,
+            5
+        };
+        LSP_REGISTER_METADATA(send_x16);
+
+        const plugin_t multisend_mono =
+        {
+            "Multi-Send Mono",
+            "Multi-Send Mono",
+            "Multi-Send Mono",
+            "MS1M",
+            &developers::v_sadovnikov,
+            "multisend_mono",
+            {
+                LSP_LV2_URI("multisend_mono"),
+                LSP_LV2UI_URI("multisend_mono"),
+                "ms1m",
+                LSP_VST3_UID("ms1m    ms1m"),
+                LSP_VST3UI_UID("ms1m    ms1m"),
+                0,
+                NULL,
+                LSP_CLAP_URI("multisend_mono"),
+                LSP_GST_UID("multisend_mono"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_mono,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            multisend_mono_ports,
+            "plugins/util/multisend.xml",
+            NULL,
+            mono_plugin_port_groups,
+            &send_bundle,
+            2
+        };
+        LSP_REGISTER_METADATA(multisend_mono);
+
+        const plugin_t sc_multisend_mono =
+        {
+            "Sidechain Multi-Send Mono",
+            "Sidechain Multi-Send Mono",
+            "Sidechain Multi-Send Mono",
+            "SMS1M",
+            &developers::v_sadovnikov,
+            "sc_multisend_mono",
+            {
+                LSP_LV2_URI("sc_multisend_mono"),
+                LSP_LV2UI_URI("sc_multisend_mono"),
+                "sm1m",
+                LSP_VST3_UID("sm1m    sm1m"),
+                LSP_VST3UI_UID("sm1m    sm1m"),
+                0,
+                NULL,
+                LSP_CLAP_URI("sc_multisend_mono"),
+                LSP_GST_UID("sc_multisend_mono"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_mono,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            sc_multisend_mono_ports,
+            "plugins/util/multisend.xml",
+            NULL,
+            mono_plugin_sidechain_port_groups,
+            &send_bundle,
+            2
+        };
+        LSP_REGISTER_METADATA(sc_multisend_mono);
+
+        const plugin_t multisend_stereo =
+        {
+            "Multi-Send Stereo",
+            "Multi-Send Stereo",
+            "Multi-Send Stereo",
+            "MS1S",
+            &developers::v_sadovnikov,
+            "multisend_stereo",
+            {
+                LSP_LV2_URI("multisend_stereo"),
+                LSP_LV2UI_URI("multisend_stereo"),
+                "ms1s",
+                LSP_VST3_UID("ms1s    ms1s"),
+                LSP_VST3UI_UID("ms1s    ms1s"),
+                0,
+                NULL,
+                LSP_CLAP_URI("multisend_stereo"),
+                LSP_GST_UID("multisend_stereo"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_stereo,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            multisend_stereo_ports,
+            "plugins/util/multisend.xml",
+            NULL,
+            stereo_plugin_port_groups,
+            &send_bundle,
+            1
+        };
+        LSP_REGISTER_METADATA(multisend_stereo);
+
+        const plugin_t sc_multisend_stereo =
+        {
+            "Sidechain Multi-Send Stereo",
+            "Sidechain Multi-Send Stereo",
+            "Sidechain Multi-Send Stereo",
+            "SMS1S",
+            &developers::v_sadovnikov,
+            "sc_multisend_stereo",
+            {
+                LSP_LV2_URI("sc_multisend_stereo"),
+                LSP_LV2UI_URI("sc_multisend_stereo"),
+                "sm1s",
+                LSP_VST3_UID("sm1s    sm1s"),
+                LSP_VST3UI_UID("sm1s    sm1s"),
+                0,
+                NULL,
+                LSP_CLAP_URI("sc_multisend_stereo"),
+                LSP_GST_UID("sc_multisend_stereo"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_stereo,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            sc_multisend_stereo_ports,
+            "plugins/util/multisend.xml",
+            NULL,
+            stereo_plugin_sidechain_port_groups,
+            &send_bundle,
+            1
+        };
+        LSP_REGISTER_METADATA(sc_multisend_stereo);
+
+        const plugin_t send_return_mono =
+        {
+            "Send Return Mono",
+            "Send Return Mono",
+            "Send Return Mono",
+            "SR1M",
+            &developers::v_sadovnikov,
+            "send_return_mono",
+            {
+                LSP_LV2_URI("send_return_mono"),
+                LSP_LV2UI_URI("send_return_mono"),
+                "sr1m",
+                LSP_VST3_UID("sr1m    sr1m"),
+                LSP_VST3UI_UID("sr1m    sr1m"),
+                0,
+                NULL,
+                LSP_CLAP_URI("send_return_mono"),
+                LSP_GST_UID("send_return_mono"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_mono,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            send_return_mono_ports,
+            "plugins/util/send_return.xml",
+            NULL,
+            mono_plugin_port_groups,
+            &send_return_bundle,
+            2
+        };
+        LSP_REGISTER_METADATA(send_return_mono);
+
+        const plugin_t send_return_stereo =
+        {
+            "Send Return Stereo",
+            "Send Return Stereo",
+            "Send Return Stereo",
+            "SR1S",
+            &developers::v_sadovnikov,
+            "send_return_stereo",
+            {
+                LSP_LV2_URI("send_return_stereo"),
+                LSP_LV2UI_URI("send_return_stereo"),
+                "sr1s",
+                LSP_VST3_UID("sr1s    sr1s"),
+                LSP_VST3UI_UID("sr1s    sr1s"),
+                0,
+                NULL,
+                LSP_CLAP_URI("send_return_stereo"),
+                LSP_GST_UID("send_return_stereo"),
+            },
+            LSP_PLUGINS_SEND_VERSION,
+            plugin_classes,
+            clap_features_stereo,
+            E_DUMP_STATE | E_SHM_TRACKING,
+            send_return_stereo_ports,
+            "plugins/util/send_return.xml",
+            NULL,
+            stereo_plugin_port_groups,
+            &send_return_bundle,
+            1
+        };
+        LSP_REGISTER_METADATA(send_return_stereo);
+
     } /* namespace meta */
 } /* namespace lsp */
@@ -0,0 +1,679 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/types.h>
+#include <private/dsp/send.h>
+
+#include <math.h>
+
+#if defined(ARCH_X86) && defined(__SSE2__)
+    #define SEND_DSP_SSE
+    #include <emmintrin.h>
+#elif defined(ARCH_AARCH64) && defined(__ARM_NEON)
+    #define SEND_DSP_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace lsp
+{
+    namespace send_dsp
+    {
+        namespace generic
+        {
+            // The peak is computed as (a > b) ? a : b to match the semantics of the MAXPS instruction
+            float process(float *out, float *send, const float *src, float k_out, float k_send, size_t count)
+            {
+                float peak      = 0.0f;
+
+                if (send != NULL)
+                {
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        const float s   = src[i];
+                        const float a   = fabsf(s);
+                        peak            = (peak > a) ? peak : a;
+                        out[i]          = s * k_out;
+                        send[i]         = s * k_send;
+                    }
+                }
+                else
+                {
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        const float s   = src[i];
+                        const float a   = fabsf(s);
+                        peak            = (peak > a) ? peak : a;
+                        out[i]          = s * k_out;
+                    }
+                }
+
+                return peak;
+            }
+
+            float process_inplace(float *dst, float *send, float k_out, float k_send, size_t count)
+            {
+                float peak      = 0.0f;
+
+                if (send != NULL)
+                {
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        const float s   = dst[i];
+                        const float a   = fabsf(s);
+                        peak            = (peak > a) ? peak : a;
+                        send[i]         = s * k_send;
+                        dst[i]          = s * k_out;
+                    }
+                }
+                else
+                {
+                    for (size_t i=0; i<count; ++i)
+                    {
+                        const float s   = dst[i];
+                        const float a   = fabsf(s);
+                        peak            = (peak > a) ? peak : a;
+                        dst[i]          = s * k_out;
+                    }
+                }
+
+                return peak;
+            }
+
+            float fanout(float *out, float * const *send, const float *src, float k_out, const float *k_send, size_t n_send, size_t count)
+            {
+                float peak      = 0.0f;
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float s   = src[i];
+                    const float a   = fabsf(s);
+                    peak            = (peak > a) ? peak : a;
+                    for (size_t j=0; j<n_send; ++j)
+                        send[j][i]      = s * k_send[j];
+                    out[i]          = s * k_out;
+                }
+
+                return peak;
+            }
+
+            void matrix(float *dl, float *dr, const float *l, const float *r, const float *m, size_t count)
+            {
+                const float m0  = m[0], m1 = m[1], m2 = m[2], m3 = m[3];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    // Separate products and sums to match SIMD kernels, FMA contraction is disabled for this unit
+                    const float sl  = l[i];
+                    const float sr  = r[i];
+                    const float l0  = sl * m0;
+                    const float r0  = sr * m1;
+                    const float l1  = sl * m2;
+                    const float r1  = sr * m3;
+                    dl[i]           = l0 + r0;
+                    dr[i]           = l1 + r1;
+                }
+            }
+
+            void mix_return(float *out, const float *dry, const float *ret, float k_dry, float k_ret, float *peaks, size_t count)
+            {
+                float pd        = peaks[0];
+                float pr        = peaks[1];
+                float po        = peaks[2];
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float d   = dry[i];
+                    const float r   = ret[i];
+                    const float vd  = d * k_dry;
+                    const float vr  = r * k_ret;
+                    const float o   = vd + vr;
+                    const float ad  = fabsf(d);
+                    const float ar  = fabsf(r);
+                    const float ao  = fabsf(o);
+                    pd              = (pd > ad) ? pd : ad;
+                    pr              = (pr > ar) ? pr : ar;
+                    po              = (po > ao) ? po : ao;
+                    out[i]          = o;
+                }
+
+                peaks[0]        = pd;
+                peaks[1]        = pr;
+                peaks[2]        = po;
+            }
+
+            void sanitize(float *dst, size_t *nonfinite, size_t *denormal, size_t count)
+            {
+                uint32_t *x     = reinterpret_cast<uint32_t *>(dst);
+                size_t nf       = 0;
+                size_t dn       = 0;
+
+                for (size_t i=0; i<count; ++i)
+                {
+                    const uint32_t a    = x[i] & 0x7fffffff;
+                    if (a > 0x7f7fffff)
+                    {
+                        x[i]                = 0;
+                        ++nf;
+                    }
+                    else if ((a > 0) && (a < 0x00800000))
+                    {
+                        x[i]                = 0;
+                        ++dn;
+                    }
+                }
+
+                *nonfinite     += nf;
+                *denormal      += dn;
+            }
+
+            void abs_max2(float *dst, const float *src, size_t count)
+            {
+                for (size_t i=0; i<count; ++i)
+                {
+                    const float d   = dst[i];
+                    const float a   = fabsf(src[i]);
+                    dst[i]          = (d > a) ? d : a;
+                }
+            }
+        } /* namespace generic */
+
+    #if defined(SEND_DSP_SSE)
+        namespace sse
+        {
+            static inline float hmax(__m128 v)
+            {
+                v   = _mm_max_ps(v, _mm_movehl_ps(v, v));
+                v   = _mm_max_ss(v, _mm_shuffle_ps(v, v, 0x55));
+                return _mm_cvtss_f32(v);
+            }
+
+            // Each input vector is loaded before the results are stored, so the output may alias the input
+            static float process(float *out, float *send, const float *src, float k_out, float k_send, size_t count)
+            {
+                const __m128 mask   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+                const __m128 vko    = _mm_set1_ps(k_out);
+                __m128 p0           = _mm_setzero_ps();
+                __m128 p1           = _mm_setzero_ps();
+                size_t i            = 0;
+
+                if (send != NULL)
+                {
+                    const __m128 vks    = _mm_set1_ps(k_send);
+                    for ( ; i + 8 <= count; i += 8)
+                    {
+                        const __m128 s0     = _mm_loadu_ps(&src[i]);
+                        const __m128 s1     = _mm_loadu_ps(&src[i+4]);
+                        p0                  = _mm_max_ps(p0, _mm_and_ps(s0, mask));
+                        p1                  = _mm_max_ps(p1, _mm_and_ps(s1, mask));
+                        _mm_storeu_ps(&send[i], _mm_mul_ps(s0, vks));
+                        _mm_storeu_ps(&send[i+4], _mm_mul_ps(s1, vks));
+                        _mm_storeu_ps(&out[i], _mm_mul_ps(s0, vko));
+                        _mm_storeu_ps(&out[i+4], _mm_mul_ps(s1, vko));
+                    }
+                    if (i + 4 <= count)
+                    {
+                        const __m128 s0     = _mm_loadu_ps(&src[i]);
+                        p0                  = _mm_max_ps(p0, _mm_and_ps(s0, mask));
+                        _mm_storeu_ps(&send[i], _mm_mul_ps(s0, vks));
+                        _mm_storeu_ps(&out[i], _mm_mul_ps(s0, vko));
+                        i                  += 4;
+                    }
+                }
+                else
+                {
+                    for ( ; i + 8 <= count; i += 8)
+                    {
+                        const __m128 s0     = _mm_loadu_ps(&src[i]);
+                        const __m128 s1     = _mm_loadu_ps(&src[i+4]);
+                        p0                  = _mm_max_ps(p0, _mm_and_ps(s0, mask));
+                        p1                  = _mm_max_ps(p1, _mm_and_ps(s1, mask));
+                        _mm_storeu_ps(&out[i], _mm_mul_ps(s0, vko));
+                        _mm_storeu_ps(&out[i+4], _mm_mul_ps(s1, vko));
+                    }
+                    if (i + 4 <= count)
+                    {
+                        const __m128 s0     = _mm_loadu_ps(&src[i]);
+                        p0                  = _mm_max_ps(p0, _mm_and_ps(s0, mask));
+                        _mm_storeu_ps(&out[i], _mm_mul_ps(s0, vko));
+                        i                  += 4;
+                    }
+                }
+
+                float peak          = hmax(_mm_max_ps(p0, p1));
+
+                // Process the tail
+                if (i < count)
+                {
+                    float *tsend        = (send != NULL) ? &send[i] : NULL;
+                    const float tail    = generic::process(&out[i], tsend, &src[i], k_out, k_send, count - i);
+                    peak                = (peak > tail) ? peak : tail;
+                }
+
+                return peak;
+            }
+
+            static float fanout(float *out, float * const *send, const float *src, float k_out, const float *k_send, size_t n_send, size_t count)
+            {
+                const __m128 mask   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+                const __m128 vko    = _mm_set1_ps(k_out);
+                __m128 p0           = _mm_setzero_ps();
+                __m128 p1           = _mm_setzero_ps();
+                size_t i            = 0;
+
+                for ( ; i + 8 <= count; i += 8)
+                {
+                    const __m128 s0     = _mm_loadu_ps(&src[i]);
+                    const __m128 s1     = _mm_loadu_ps(&src[i+4]);
+                    p0                  = _mm_max_ps(p0, _mm_and_ps(s0, mask));
+                    p1                  = _mm_max_ps(p1, _mm_and_ps(s1, mask));
+                    for (size_t j=0; j<n_send; ++j)
+                    {
+                        const __m128 vks    = _mm_set1_ps(k_send[j]);
+                        _mm_storeu_ps(&send[j][i], _mm_mul_ps(s0, vks));
+                        _mm_storeu_ps(&send[j][i+4], _mm_mul_ps(s1, vks));
+                    }
+                    _mm_storeu_ps(&out[i], _mm_mul_ps(s0, vko));
+                    _mm_storeu_ps(&out[i+4], _mm_mul_ps(s1, vko));
+                }
+
+                float peak          = hmax(_mm_max_ps(p0, p1));
+
+                // Process the tail
+                for ( ; i < count; ++i)
+                {
+                    const float s       = src[i];
+                    const float a       = fabsf(s);
+                    peak                = (peak > a) ? peak : a;
+                    for (size_t j=0; j<n_send; ++j)
+                        send[j][i]          = s * k_send[j];
+                    out[i]              = s * k_out;
+                }
+
+                return peak;
+            }
+
+            static void matrix(float *dl, float *dr, const float *l, const float *r, const float *m, size_t count)
+            {
+                const __m128 m0     = _mm_set1_ps(m[0]);
+                const __m128 m1     = _mm_set1_ps(m[1]);
+                const __m128 m2     = _mm_set1_ps(m[2]);
+                const __m128 m3     = _mm_set1_ps(m[3]);
+                size_t i            = 0;
+
+                for ( ; i + 8 <= count; i += 8)
+                {
+                    const __m128 l0     = _mm_loadu_ps(&l[i]);
+                    const __m128 l1     = _mm_loadu_ps(&l[i+4]);
+                    const __m128 r0     = _mm_loadu_ps(&r[i]);
+                    const __m128 r1     = _mm_loadu_ps(&r[i+4]);
+                    _mm_storeu_ps(&dl[i], _mm_add_ps(_mm_mul_ps(l0, m0), _mm_mul_ps(r0, m1)));
+                    _mm_storeu_ps(&dl[i+4], _mm_add_ps(_mm_mul_ps(l1, m0), _mm_mul_ps(r1, m1)));
+                    _mm_storeu_ps(&dr[i], _mm_add_ps(_mm_mul_ps(l0, m2), _mm_mul_ps(r0, m3)));
+                    _mm_storeu_ps(&dr[i+4], _mm_add_ps(_mm_mul_ps(l1, m2), _mm_mul_ps(r1, m3)));
+                }
+
+                generic::matrix(&dl[i], &dr[i], &l[i], &r[i], m, count - i);
+            }
+
+            // Each input vector is loaded before the result is stored, so the output may alias the inputs
+            static void mix_return(float *out, const float *dry, const float *ret, float k_dry, float k_ret, float *peaks, size_t count)
+            {
+                const __m128 mask   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+                const __m128 vkd    = _mm_set1_ps(k_dry);
+                const __m128 vkr    = _mm_set1_ps(k_ret);
+                __m128 pd           = _mm_setzero_ps();
+                __m128 pr           = _mm_setzero_ps();
+                __m128 po           = _mm_setzero_ps();
+                size_t i            = 0;
+
+                for ( ; i + 4 <= count; i += 4)
+                {
+                    const __m128 d      = _mm_loadu_ps(&dry[i]);
+                    const __m128 r      = _mm_loadu_ps(&ret[i]);
+                    const __m128 o      = _mm_add_ps(_mm_mul_ps(d, vkd), _mm_mul_ps(r, vkr));
+                    pd                  = _mm_max_ps(pd, _mm_and_ps(d, mask));
+                    pr                  = _mm_max_ps(pr, _mm_and_ps(r, mask));
+                    po                  = _mm_max_ps(po, _mm_and_ps(o, mask));
+                    _mm_storeu_ps(&out[i], o);
+                }
+
+                float v[3]          = { hmax(pd), hmax(pr), hmax(po) };
+                for (size_t j=0; j<3; ++j)
+                    peaks[j]            = (peaks[j] > v[j]) ? peaks[j] : v[j];
+
+                generic::mix_return(&out[i], &dry[i], &ret[i], k_dry, k_ret, peaks, count - i);
+            }
+
+            static inline size_t hsum(__m128i v)
+            {
+                v   = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4e));
+                v   = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xb1));
+                return uint32_t(_mm_cvtsi128_si32(v));
+            }
+
+            // Magnitudes are compared as signed integers since the sign bit is cleared, lanes of
+            // the comparison masks are -1, so they are subtracted from the counters
+            static void sanitize(float *dst, size_t *nonfinite, size_t *denormal, size_t count)
+            {
+                const __m128i mask  = _mm_set1_epi32(0x7fffffff);
+                const __m128i fmax  = _mm_set1_epi32(0x7f7fffff);
+                const __m128i nmin  = _mm_set1_epi32(0x00800000);
+                const __m128i zero  = _mm_setzero_si128();
+                __m128i nf          = _mm_setzero_si128();
+                __m128i dn          = _mm_setzero_si128();
+                size_t i            = 0;
+
+                for ( ; i + 4 <= count; i += 4)
+                {
+                    const __m128i x     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&dst[i]));
+                    const __m128i a     = _mm_and_si128(x, mask);
+                    const __m128i inf   = _mm_cmpgt_epi32(a, fmax);
+                    const __m128i den   = _mm_and_si128(_mm_cmplt_epi32(a, nmin), _mm_cmpgt_epi32(a, zero));
+                    nf                  = _mm_sub_epi32(nf, inf);
+                    dn                  = _mm_sub_epi32(dn, den);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[i]), _mm_andnot_si128(_mm_or_si128(inf, den), x));
+                }
+
+                *nonfinite         += hsum(nf);
+                *denormal          += hsum(dn);
+
+                generic::sanitize(&dst[i], nonfinite, denormal, count - i);
+            }
+
+            static void abs_max2(float *dst, const float *src, size_t count)
+            {
+                const __m128 mask   = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+                size_t i            = 0;
+
+                for ( ; i + 8 <= count; i += 8)
+                {
+                    const __m128 a0     = _mm_and_ps(_mm_loadu_ps(&src[i]), mask);
+                    const __m128 a1     = _mm_and_ps(_mm_loadu_ps(&src[i+4]), mask);
+                    _mm_storeu_ps(&dst[i], _mm_max_ps(_mm_loadu_ps(&dst[i]), a0));
+                    _mm_storeu_ps(&dst[i+4], _mm_max_ps(_mm_loadu_ps(&dst[i+4]), a1));
+                }
+
+                generic::abs_max2(&dst[i], &src[i], count - i);
+            }
+        } /* namespace sse */
+    #endif /* SEND_DSP_SSE */
+
+    #if defined(SEND_DSP_NEON)
+        namespace neon
+        {
+            // Each input vector is loaded before the results are stored, so the output may alias the input
+            static float process(float *out, float *send, const float *src, float k_out, float k_send, size_t count)
+            {
+                const float32x4_t vko   = vdupq_n_f32(k_out);
+                float32x4_t p0          = vdupq_n_f32(0.0f);
+                float32x4_t p1          = vdupq_n_f32(0.0f);
+                size_t i                = 0;
+
+                if (send != NULL)
+                {
+                    const float32x4_t vks   = vdupq_n_f32(k_send);
+                    for ( ; i + 8 <= count; i += 8)
+                    {
+                        const float32x4_t s0    = vld1q_f32(&src[i]);
+                        const float32x4_t s1    = vld1q_f32(&src[i+4]);
+                        p0                      = vmaxq_f32(p0, vabsq_f32(s0));
+                        p1                      = vmaxq_f32(p1, vabsq_f32(s1));
+                        vst1q_f32(&send[i], vmulq_f32(s0, vks));
+                        vst1q_f32(&send[i+4], vmulq_f32(s1, vks));
+                        vst1q_f32(&out[i], vmulq_f32(s0, vko));
+                        vst1q_f32(&out[i+4], vmulq_f32(s1, vko));
+                    }
+                }
+                else
+                {
+                    for ( ; i + 8 <= count; i += 8)
+                    {
+                        const float32x4_t s0    = vld1q_f32(&src[i]);
+                        const float32x4_t s1    = vld1q_f32(&src[i+4]);
+                        p0                      = vmaxq_f32(p0, vabsq_f32(s0));
+                        p1                      = vmaxq_f32(p1, vabsq_f32(s1));
+                        vst1q_f32(&out[i], vmulq_f32(s0, vko));
+                        vst1q_f32(&out[i+4], vmulq_f32(s1, vko));
+                    }
+                }
+
+                float peak              = vmaxvq_f32(vmaxq_f32(p0, p1));
+
+                // Process the tail
+                if (i < count)
+                {
+                    float *tsend        = (send != NULL) ? &send[i] : NULL;
+                    const float tail    = generic::process(&out[i], tsend, &src[i], k_out, k_send, count - i);
+                    peak                = (peak > tail) ? peak : tail;
+                }
+
+                return peak;
+            }
+
+            static float fanout(float *out, float * const *send, const float *src, float k_out, const float *k_send, size_t n_send, size_t count)
+            {
+                const float32x4_t vko   = vdupq_n_f32(k_out);
+                float32x4_t p0          = vdupq_n_f32(0.0f);
+                float32x4_t p1          = vdupq_n_f32(0.0f);
+                size_t i                = 0;
+
+                for ( ; i + 8 <= count; i += 8)
+                {
+                    const float32x4_t s0    = vld1q_f32(&src[i]);
+                    const float32x4_t s1    = vld1q_f32(&src[i+4]);
+                    p0                      = vmaxq_f32(p0, vabsq_f32(s0));
+                    p1                      = vmaxq_f32(p1, vabsq_f32(s1));
+                    for (size_t j=0; j<n_send; ++j)
+                    {
+                        const float32x4_t vks   = vdupq_n_f32(k_send[j]);
+                        vst1q_f32(&send[j][i], vmulq_f32(s0, vks));
+                        vst1q_f32(&send[j][i+4], vmulq_f32(s1, vks));
+                    }
+                    vst1q_f32(&out[i], vmulq_f32(s0, vko));
+                    vst1q_f32(&out[i+4], vmulq_f32(s1, vko));
+                }
+
+                float peak              = vmaxvq_f32(vmaxq_f32(p0, p1));
+
+                // Process the tail
+                for ( ; i < count; ++i)
+                {
+                    const float s           = src[i];
+                    const float a           = fabsf(s);
+                    peak                    = (peak > a) ? peak : a;
+                    for (size_t j=0; j<n_send; ++j)
+                        send[j][i]              = s * k_send[j];
+                    out[i]                  = s * k_out;
+                }
+
+                return peak;
+            }
+
+            static void matrix(float *dl, float *dr, const float *l, const float *r, const float *m, size_t count)
+            {
+                size_t i                = 0;
+
+                for ( ; i + 8 <= count; i += 8)
+                {
+                    const float32x4_t l0    = vld1q_f32(&l[i]);
+                    const float32x4_t l1    = vld1q_f32(&l[i+4]);
+                    const float32x4_t r0    = vld1q_f32(&r[i]);
+                    const float32x4_t r1    = vld1q_f32(&r[i+4]);
+                    vst1q_f32(&dl[i], vaddq_f32(vmulq_n_f32(l0, m[0]), vmulq_n_f32(r0, m[1])));
+                    vst1q_f32(&dl[i+4], vaddq_f32(vmulq_n_f32(l1, m[0]), vmulq_n_f32(r1, m[1])));
+                    vst1q_f32(&dr[i], vaddq_f32(vmulq_n_f32(l0, m[2]), vmulq_n_f32(r0, m[3])));
+                    vst1q_f32(&dr[i+4], vaddq_f32(vmulq_n_f32(l1, m[2]), vmulq_n_f32(r1, m[3])));
+                }
+
+                generic::matrix(&dl[i], &dr[i], &l[i], &r[i], m, count - i);
+            }
+
+            // Each input vector is loaded before the result is stored, so the output may alias the inputs
+            static void mix_return(float *out, const float *dry, const float *ret, float k_dry, float k_ret, float *peaks, size_t count)
+            {
+                float32x4_t pd          = vdupq_n_f32(0.0f);
+                float32x4_t pr          = vdupq_n_f32(0.0f);
+                float32x4_t po          = vdupq_n_f32(0.0f);
+                size_t i                = 0;
+
+                for ( ; i + 4 <= count; i += 4)
+                {
+                    const float32x4_t d     = vld1q_f32(&dry[i]);
+                    const float32x4_t r     = vld1q_f32(&ret[i]);
+                    const float32x4_t o     = vaddq_f32(vmulq_n_f32(d, k_dry), vmulq_n_f32(r, k_ret));
+                    pd                      = vmaxq_f32(pd, vabsq_f32(d));
+                    pr                      = vmaxq_f32(pr, vabsq_f32(r));
+                    po                      = vmaxq_f32(po, vabsq_f32(o));
+                    vst1q_f32(&out[i], o);
+                }
+
+                float v[3]              = { vmaxvq_f32(pd), vmaxvq_f32(pr), vmaxvq_f32(po) };
+                for (size_t j=0; j<3; ++j)
+                    peaks[j]                = (peaks[j] > v[j]) ? peaks[j] : v[j];
+
+                generic::mix_return(&out[i], &dry[i], &ret[i], k_dry, k_ret, peaks, count - i);
+            }
+
+            // Lanes of the comparison masks are all ones, so they are subtracted from the counters
+            static void sanitize(float *dst, size_t *nonfinite, size_t *denormal, size_t count)
+            {
+                const uint32x4_t mask   = vdupq_n_u32(0x7fffffff);
+                const uint32x4_t fmax   = vdupq_n_u32(0x7f7fffff);
+                const uint32x4_t nmin   = vdupq_n_u32(0x00800000);
+                const uint32x4_t zero   = vdupq_n_u32(0);
+                uint32x4_t nf           = vdupq_n_u32(0);
+                uint32x4_t dn           = vdupq_n_u32(0);
+                uint32_t *x             = reinterpret_cast<uint32_t *>(dst);
+                size_t i                = 0;
+
+                for ( ; i + 4 <= count; i += 4)
+                {
+                    const uint32x4_t v      = vld1q_u32(&x[i]);
+                    const uint32x4_t a      = vandq_u32(v, mask);
+                    const uint32x4_t inf    = vcgtq_u32(a, fmax);
+                    const uint32x4_t den    = vandq_u32(vcltq_u32(a, nmin), vcgtq_u32(a, zero));
+                    nf                      = vsubq_u32(nf, inf);
+                    dn                      = vsubq_u32(dn, den);
+                    vst1q_u32(&x[i], vbicq_u32(v, vorrq_u32(inf, den)));
+                }
+
+                *nonfinite             += vaddvq_u32(nf);
+                *denormal              += vaddvq_u32(dn);
+
+                generic::sanitize(&dst[i], nonfinite, denormal, count - i);
+            }
+
+            static void abs_max2(float *dst, const float *src, size_t count)
+            {
+                size_t i                = 0;
+
+                for ( ; i + 8 <= count; i += 8)
+                {
+                    const float32x4_t a0    = vabsq_f32(vld1q_f32(&src[i]));
+                    const float32x4_t a1    = vabsq_f32(vld1q_f32(&src[i+4]));
+                    vst1q_f32(&dst[i], vmaxq_f32(vld1q_f32(&dst[i]), a0));
+                    vst1q_f32(&dst[i+4], vmaxq_f32(vld1q_f32(&dst[i+4]), a1));
+                }
+
+                generic::abs_max2(&dst[i], &src[i], count - i);
+            }
+        } /* namespace neon */
+    #endif /* SEND_DSP_NEON */
+
+        float process(float *out, float *send, const float *src, float k_out, float k_send, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            return sse::process(out, send, src, k_out, k_send, count);
+        #elif defined(SEND_DSP_NEON)
+            return neon::process(out, send, src, k_out, k_send, count);
+        #else
+            return generic::process(out, send, src, k_out, k_send, count);
+        #endif
+        }
+
+        float process_inplace(float *dst, float *send, float k_out, float k_send, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            return sse::process(dst, send, dst, k_out, k_send, count);
+        #elif defined(SEND_DSP_NEON)
+            return neon::process(dst, send, dst, k_out, k_send, count);
+        #else
+            return generic::process_inplace(dst, send, k_out, k_send, count);
+        #endif
+        }
+
+        float fanout(float *out, float * const *send, const float *src, float k_out, const float *k_send, size_t n_send, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            return sse::fanout(out, send, src, k_out, k_send, n_send, count);
+        #elif defined(SEND_DSP_NEON)
+            return neon::fanout(out, send, src, k_out, k_send, n_send, count);
+        #else
+            return generic::fanout(out, send, src, k_out, k_send, n_send, count);
+        #endif
+        }
+
+        void matrix(float *dl, float *dr, const float *l, const float *r, const float *m, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            sse::matrix(dl, dr, l, r, m, count);
+        #elif defined(SEND_DSP_NEON)
+            neon::matrix(dl, dr, l, r, m, count);
+        #else
+            generic::matrix(dl, dr, l, r, m, count);
+        #endif
+        }
+
+        void mix_return(float *out, const float *dry, const float *ret, float k_dry, float k_ret, float *peaks, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            sse::mix_return(out, dry, ret, k_dry, k_ret, peaks, count);
+        #elif defined(SEND_DSP_NEON)
+            neon::mix_return(out, dry, ret, k_dry, k_ret, peaks, count);
+        #else
+            generic::mix_return(out, dry, ret, k_dry, k_ret, peaks, count);
+        #endif
+        }
+
+        void sanitize(float *dst, size_t *nonfinite, size_t *denormal, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            sse::sanitize(dst, nonfinite, denormal, count);
+        #elif defined(SEND_DSP_NEON)
+            neon::sanitize(dst, nonfinite, denormal, count);
+        #else
+            generic::sanitize(dst, nonfinite, denormal, count);
+        #endif
+        }
+
+        void abs_max2(float *dst, const float *src, size_t count)
+        {
+        #if defined(SEND_DSP_SSE)
+            sse::abs_max2(dst, src, count);
+        #elif defined(SEND_DSP_NEON)
+            neon::abs_max2(dst, src, count);
+        #else
+            generic::abs_max2(dst, src, count);
+        #endif
+        }
+
+    } /* namespace send_dsp */
+} /* namespace lsp */
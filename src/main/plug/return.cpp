@@ -0,0 +1,300 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/shared/debug.h>
+
+#include <private/dsp/send.h>
+#include <private/plugins/return.h>
+
+namespace lsp
+{
+    namespace plugins
+    {
+        //---------------------------------------------------------------------
+        // Implementation
+        static constexpr size_t BUFFER_SIZE         = 0x400;        // Size of the temporary buffer in samples
+        static constexpr size_t CACHE_LINE_SIZE     = 64;           // Alignment of the allocated data
+
+        return_plugin::return_plugin(const meta::plugin_t *meta):
+            Module(meta)
+        {
+            // Compute the number of audio channels by the number of inputs
+            nChannels       = 0;
+            for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+            {
+                if (meta::is_audio_in_port(p))
+                    ++nChannels;
+            }
+
+            vChannels       = NULL;
+            vBuffer         = NULL;
+            fInGain         = GAIN_AMP_M_INF_DB;
+            fReturnGain     = GAIN_AMP_M_INF_DB;
+            fOutGain        = GAIN_AMP_M_INF_DB;
+            bBypass         = false;
+            nBypassFade     = 0;
+            nBypassTail     = 0;
+
+            pBypass         = NULL;
+            pInGain         = NULL;
+            pOutGain        = NULL;
+            pReturnGain     = NULL;
+
+            pData           = NULL;
+        }
+
+        return_plugin::~return_plugin()
+        {
+            do_destroy();
+        }
+
+        void return_plugin::init(plug::IWrapper *wrapper, plug::IPort **ports)
+        {
+            // Call parent class for initialization
+            Module::init(wrapper, ports);
+
+            // Channel state and the mixing buffer share one cache-aligned allocation
+            const size_t szof_buf   = align_size(sizeof(float) * BUFFER_SIZE, CACHE_LINE_SIZE);
+            const size_t szof_chan  = align_size(sizeof(channel_t) * nChannels, CACHE_LINE_SIZE);
+
+            uint8_t *ptr        = alloc_aligned<uint8_t>(pData, szof_buf + szof_chan, CACHE_LINE_SIZE);
+            if (ptr == NULL)
+                return;
+
+            vBuffer             = advance_ptr_bytes<float>(ptr, szof_buf);
+            vChannels           = advance_ptr_bytes<channel_t>(ptr, szof_chan);
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+
+                c->sBypass.construct();
+                c->vPeak[0]         = 0.0f;
+                c->vPeak[1]         = 0.0f;
+                c->vPeak[2]         = 0.0f;
+
+                c->pIn              = NULL;
+                c->pOut             = NULL;
+                c->pReturn          = NULL;
+
+                c->pInMeter         = NULL;
+                c->pReturnMeter     = NULL;
+                c->pOutMeter        = NULL;
+            }
+
+            size_t port_id      = 0;
+
+            // Bind inputs and outpus
+            lsp_trace("Binding inputs and outputs");
+            for (size_t i=0; i<nChannels; ++i)
+                BIND_PORT(vChannels[i].pIn);
+            for (size_t i=0; i<nChannels; ++i)
+                BIND_PORT(vChannels[i].pOut);
+
+            lsp_trace("Binding common ports");
+            BIND_PORT(pBypass);
+            BIND_PORT(pInGain);
+            BIND_PORT(pOutGain);
+            BIND_PORT(pReturnGain);
+
+            lsp_trace("Binding return ports");
+            SKIP_PORT("Return name");
+            for (size_t i=0; i<nChannels; ++i)
+                BIND_PORT(vChannels[i].pReturn);
+
+            lsp_trace("Binding meters");
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+
+                BIND_PORT(c->pInMeter);
+                BIND_PORT(c->pReturnMeter);
+                BIND_PORT(c->pOutMeter);
+            }
+        }
+
+        void return_plugin::destroy()
+        {
+            Module::destroy();
+            do_destroy();
+        }
+
+        void return_plugin::do_destroy()
+        {
+            if (vChannels != NULL)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    vChannels[i].sBypass.destroy();
+                vChannels       = NULL;
+            }
+
+            if (pData != NULL)
+            {
+                free_aligned(pData);
+                pData           = NULL;
+            }
+
+            vBuffer         = NULL;
+        }
+
+        void return_plugin::update_sample_rate(long sr)
+        {
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].sBypass.init(sr, meta::send::BYPASS_TIME);
+
+            // Bypass state has been reset, let it settle with the crossfade
+            nBypassFade             = size_t(dspu::seconds_to_samples(sr, meta::send::BYPASS_TIME)) + 1;
+            nBypassTail             = nBypassFade;
+        }
+
+        void return_plugin::update_settings()
+        {
+            const bool bypass       = pBypass->value() >= 0.5f;
+
+            fInGain                 = pInGain->value();
+            fReturnGain             = pReturnGain->value();
+            fOutGain                = pOutGain->value();
+
+            if (bypass != bBypass)
+            {
+                bBypass                 = bypass;
+                nBypassTail             = nBypassFade;
+            }
+
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].sBypass.set_bypass(bypass);
+        }
+
+        void return_plugin::process(size_t samples)
+        {
+            // The return signal is mixed directly to the output only if bypass has settled
+            const bool fused        = (!bBypass) && (nBypassTail == 0);
+            const float k_dry       = fInGain * fOutGain;
+            const float k_ret       = fReturnGain * fOutGain;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                const float *in     = c->pIn->buffer<float>();
+                float *out          = c->pOut->buffer<float>();
+                core::AudioBuffer *rb = c->pReturn->buffer<core::AudioBuffer>();
+                const float *ret    = ((rb != NULL) && (rb->active())) ? rb->buffer() : NULL;
+
+                c->vPeak[0]         = 0.0f;
+                c->vPeak[1]         = 0.0f;
+                c->vPeak[2]         = 0.0f;
+                float out_peak      = 0.0f;
+
+                for (size_t offset=0; offset < samples; )
+                {
+                    const size_t to_do  = lsp_min(samples - offset, BUFFER_SIZE);
+                    const float *src    = &in[offset];
+                    float *dst          = (fused) ? &out[offset] : vBuffer;
+
+                    if (ret != NULL)
+                    {
+                        send_dsp::mix_return(dst, src, &ret[offset], k_dry, k_ret, c->vPeak, to_do);
+                    }
+                    else
+                    {
+                        const float peak    = (src == dst) ?
+                            send_dsp::process_inplace(dst, NULL, k_dry, 0.0f, to_do) :
+                            send_dsp::process(dst, NULL, src, k_dry, 0.0f, to_do);
+                        c->vPeak[0]         = lsp_max(c->vPeak[0], peak);
+                        c->vPeak[2]         = lsp_max(c->vPeak[2], peak * k_dry);
+                    }
+
+                    // While bypassing, the output differs from the mix and is measured separately
+                    if (!fused)
+                    {
+                        c->sBypass.process(&out[offset], src, dst, to_do);
+                        out_peak            = lsp_max(out_peak, dsp::abs_max(&out[offset], to_do));
+                    }
+
+                    offset             += to_do;
+                }
+
+                if (!fused)
+                    c->vPeak[2]         = out_peak;
+
+                // Update meters
+                if (c->pInMeter != NULL)
+                    c->pInMeter->set_value(c->vPeak[0] * fInGain);
+                if (c->pReturnMeter != NULL)
+                    c->pReturnMeter->set_value(c->vPeak[1] * fReturnGain);
+                if (c->pOutMeter != NULL)
+                    c->pOutMeter->set_value(c->vPeak[2]);
+            }
+
+            nBypassTail            -= lsp_min(nBypassTail, samples);
+        }
+
+        void return_plugin::dump(dspu::IStateDumper *v) const
+        {
+            plug::Module::dump(v);
+
+            v->write("nChannels", nChannels);
+            v->begin_array("vChannels", vChannels, nChannels);
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    const channel_t *c = &vChannels[i];
+
+                    v->begin_object(c, sizeof(channel_t));
+                    {
+                        v->write_object("sBypass", &c->sBypass);
+                        v->writev("vPeak", c->vPeak, 3);
+
+                        v->write("pIn", c->pIn);
+                        v->write("pOut", c->pOut);
+                        v->write("pReturn", c->pReturn);
+
+                        v->write("pInMeter", c->pInMeter);
+                        v->write("pReturnMeter", c->pReturnMeter);
+                        v->write("pOutMeter", c->pOutMeter);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+            v->write("vBuffer", vBuffer);
+            v->write("fInGain", fInGain);
+            v->write("fReturnGain", fReturnGain);
+            v->write("fOutGain", fOutGain);
+            v->write("bBypass", bBypass);
+            v->write("nBypassFade", nBypassFade);
+            v->write("nBypassTail", nBypassTail);
+
+            v->write("pBypass", pBypass);
+            v->write("pInGain", pInGain);
+            v->write("pOutGain", pOutGain);
+            v->write("pReturnGain", pReturnGain);
+
+            v->write("pData", pData);
+        }
+
+    } /* namespace plugins */
+} /* namespace lsp */
@@ -27,8 +27,12 @@
 #include <lsp-plug.in/plug-fw/meta/func.h>
 #include <lsp-plug.in/shared/debug.h>
 
+#include <private/dsp/send.h>
+#include <private/plugins/return.h>
 #include <private/plugins/send.h>
 
+#include <math.h>
+
 namespace lsp
 {
     namespace plugins
@@ -38,37 +42,136 @@ namespace lsp
         static const meta::plugin_t *plugins[] =
         {
             &meta::send_mono,
-            &meta::send_stereo
+            &meta::send_stereo,
+            &meta::sc_send_mono,
+            &meta::sc_send_stereo,
+            &meta::send_5_1,
+            &meta::send_7_1,
+            &meta::send_x16,
+            &meta::multisend_mono,
+            &meta::multisend_stereo,
+            &meta::sc_multisend_mono,
+            &meta::sc_multisend_stereo,
+            &meta::send_return_mono,
+            &meta::send_return_stereo
         };
 
         static plug::Module *plugin_factory(const meta::plugin_t *meta)
         {
+            if ((meta == &meta::send_return_mono) || (meta == &meta::send_return_stereo))
+                return new return_plugin(meta);
             return new send(meta);
         }
 
-        static plug::Factory factory(plugin_factory, plugins, 2);
+        static plug::Factory factory(plugin_factory, plugins, 13);
 
         //---------------------------------------------------------------------
         // Implementation
+        static constexpr size_t CACHE_LINE_SIZE     = 64;
+        static constexpr size_t SILENCE_MAX         = 0x40000000;   // Saturation limit of the silence counter
+        static constexpr size_t GATE_CHUNK          = 0x400;        // Maximum block processed at once while the send gate is enabled
+        static constexpr float  GATE_FLOOR          = 1e-5f;        // Send gate gain below this level (-100 dB) is considered closed
+
+        // Value of the parameter ramped linearly across the block at the specified position
+        static inline float ramp_value(float from, float to, size_t position, size_t length)
+        {
+            return (position < length) ? from + (to - from) * (float(position) / float(length)) : to;
+        }
+
+        // Coefficient of the one-pole smoother which reaches 1-1/e of the step in the specified time
+        static inline float smooth_coeff(float sample_rate, float seconds)
+        {
+            const float samples     = seconds * sample_rate;
+            return (samples > 1.0f) ? 1.0f - expf(-1.0f / samples) : 1.0f;
+        }
+
         send::send(const meta::plugin_t *meta):
             Module(meta)
         {
-            // Compute the number of audio channels by the number of inputs
+            // Compute the number of audio channels by the number of outputs since sidechain variants
+            // also have one sidechain input per channel, and the number of send links by the number
+            // of connection point names
+            size_t inputs   = 0;
             nChannels       = 0;
+            nLinks          = 0;
 
             for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+            {
                 if (meta::is_audio_in_port(p))
+                    ++inputs;
+                else if (meta::is_audio_out_port(p))
                     ++nChannels;
+                else if (p->role == meta::R_SEND_NAME)
+                    ++nLinks;
+            }
+            bSidechain      = inputs > nChannels;
 
             vChannels       = NULL;
+            vTaps           = NULL;
+            vLinks          = NULL;
+            vIn             = NULL;
+            vOut            = NULL;
+            vSend           = NULL;
+            vPeak           = NULL;
+            vActive         = NULL;
+            vActiveGain     = NULL;
             fInGain         = GAIN_AMP_M_INF_DB;
             fOutGain        = GAIN_AMP_M_INF_DB;
-            fSendGain       = GAIN_AMP_M_INF_DB;
+            fOldOutGain     = GAIN_AMP_M_INF_DB;
+            bBypass         = false;
+            nBypassFade     = 0;
+            nBypassTail     = 0;
+            nBlockOffset    = 0;
+            nBlockSize      = 0;
+            nDelay          = 0;
+            bScrub          = false;
+            bGate           = false;
+            bGateSc         = false;
+            fGateThresh     = meta::send::GATE_THRESH_DFL;
+            fGateAttack     = 1.0f;
+            fGateRelease    = 1.0f;
+            fGateFall       = 1.0f;
+            fGateEnv        = 0.0f;
+            fGateGain       = GAIN_AMP_0_DB;
+            nGateClosed     = 0;
+            vGate           = NULL;
+            bLoudness       = false;
+            nLoudStep       = 1;
+            nLoudPhase      = 0;
+            nLoudBlock      = 0;
+            nConnected      = 0;
+            nConnEvents     = 0;
+            pFast           = NULL;
+            for (size_t i=0; i<10; ++i)
+                vKCoeff[i]      = 0.0f;
 
             pBypass         = NULL;
             pInGain         = NULL;
             pOutGain        = NULL;
-            pSendGain       = NULL;
+            pDelayMode      = NULL;
+            pReportLatency  = NULL;
+            pScrub          = NULL;
+            pGate           = NULL;
+            pGateSc         = NULL;
+            pGateThresh     = NULL;
+            pGateAttack     = NULL;
+            pGateRelease    = NULL;
+            pGateMeter      = NULL;
+            pLoudness       = NULL;
+            pConnected      = NULL;
+            pHistory        = NULL;
+
+        #if LSP_SEND_PROFILING
+            reset_profile(&sProfile);
+            reset_profile(&sWindow);
+            nProfilePeriod  = 0;
+
+            pProfileMin     = NULL;
+            pProfileAvg     = NULL;
+            pProfileMax     = NULL;
+        #endif /* LSP_SEND_PROFILING */
+
+            pData           = NULL;
         }
 
         send::~send()
@@ -81,24 +184,137 @@ namespace lsp
             // Call parent class for initialization
             Module::init(wrapper, ports);
 
-            size_t to_alloc     = sizeof(channel_t) * nChannels;
-            vChannels           = static_cast<channel_t *>(malloc(to_alloc));
-            if (vChannels == NULL)
+            const size_t num_taps   = nChannels * nLinks;
+
+            // Hot per-channel data is stored as structure of arrays, each array starts at cache line
+            const size_t szof_ptrs  = align_size(sizeof(float *) * nChannels, CACHE_LINE_SIZE);
+            const size_t szof_peaks = align_size(sizeof(float) * nChannels, CACHE_LINE_SIZE);
+            const size_t szof_sends = align_size(sizeof(float *) * num_taps, CACHE_LINE_SIZE);
+            const size_t szof_act   = align_size(sizeof(float *) * nLinks, CACHE_LINE_SIZE);
+            const size_t szof_gains = align_size(sizeof(float) * nLinks, CACHE_LINE_SIZE);
+            const size_t szof_gate  = align_size(sizeof(float) * GATE_CHUNK, CACHE_LINE_SIZE);
+            const size_t szof_chan  = align_size(sizeof(channel_t) * nChannels, CACHE_LINE_SIZE);
+            const size_t szof_links = align_size(sizeof(link_t) * nLinks, CACHE_LINE_SIZE);
+            const size_t szof_taps  = align_size(sizeof(tap_t) * num_taps, CACHE_LINE_SIZE);
+            size_t to_alloc     = szof_ptrs * 2 + szof_peaks + szof_sends + szof_act + szof_gains +
+                                  szof_gate +
+                                  szof_chan + szof_links + szof_taps;
+
+            uint8_t *ptr        = alloc_aligned<uint8_t>(pData, to_alloc, CACHE_LINE_SIZE);
+            if (ptr == NULL)
                 return;
 
+            vIn                 = advance_ptr_bytes<const float *>(ptr, szof_ptrs);
+            vOut                = advance_ptr_bytes<float *>(ptr, szof_ptrs);
+            vSend               = advance_ptr_bytes<float *>(ptr, szof_sends);
+            vPeak               = advance_ptr_bytes<float>(ptr, szof_peaks);
+            vActive             = advance_ptr_bytes<float *>(ptr, szof_act);
+            vActiveGain         = advance_ptr_bytes<float>(ptr, szof_gains);
+            vGate               = advance_ptr_bytes<float>(ptr, szof_gate);
+
+            // Cold per-channel data, all structures are constructed before anything can fail
+            vChannels           = advance_ptr_bytes<channel_t>(ptr, szof_chan);
+            vLinks              = advance_ptr_bytes<link_t>(ptr, szof_links);
+            vTaps               = advance_ptr_bytes<tap_t>(ptr, szof_taps);
+
+            for (size_t i=0; i<nLinks; ++i)
+            {
+                link_t *l           = &vLinks[i];
+
+                l->fGain            = GAIN_AMP_M_INF_DB;
+                l->fOldGain         = GAIN_AMP_M_INF_DB;
+                l->nLatency         = 0;
+                l->nDelay           = 0;
+                l->bParked          = false;
+                l->bMatrix          = false;
+                l->bRouted          = false;
+                l->bFilter          = false;
+                l->nTail            = 0;
+                l->vMatrix[0]       = GAIN_AMP_M_INF_DB;
+                l->vMatrix[1]       = GAIN_AMP_M_INF_DB;
+                l->vMatrix[2]       = GAIN_AMP_M_INF_DB;
+                l->vMatrix[3]       = GAIN_AMP_M_INF_DB;
+                for (size_t k=0; k<4; ++k)
+                    l->vOldMatrix[k]    = GAIN_AMP_M_INF_DB;
+                l->fLoudSum         = 0.0f;
+                l->fRmsSum          = 0.0f;
+                l->nLoudCount       = 0;
+                l->nLoudHead        = 0;
+                for (size_t k=0; k<meta::send::LOUDNESS_SHORT_TERM; ++k)
+                    l->vLoudHist[k]     = 0.0f;
+                for (size_t k=0; k<meta::send::LOUDNESS_MOMENTARY; ++k)
+                    l->vRmsHist[k]      = 0.0f;
+                l->nConnected       = 0;
+
+                l->pGain            = NULL;
+                l->pDelaySamples    = NULL;
+                l->pDelayTime       = NULL;
+                l->pRouting         = NULL;
+                l->pHpfSlope        = NULL;
+                l->pHpfFreq         = NULL;
+                l->pLpfSlope        = NULL;
+                l->pLpfFreq         = NULL;
+                l->pSilent          = NULL;
+                l->pConnState       = NULL;
+                l->pRms             = NULL;
+                l->pMomentary       = NULL;
+                l->pShortTerm       = NULL;
+
+                vActive[i]          = NULL;
+                vActiveGain[i]      = 0.0f;
+            }
+
+            for (size_t i=0; i<num_taps; ++i)
+            {
+                tap_t *t            = &vTaps[i];
+
+                t->sBypass.construct();
+                t->sDelay.construct();
+                t->sFilter.construct();
+                t->pZero            = NULL;
+                t->nZero            = 0;
+                for (size_t j=0; j<4; ++j)
+                    t->vKState[j]       = 0.0f;
+                t->pSendBuf         = NULL;
+                t->bConnected       = false;
+
+                t->pSend            = NULL;
+                t->pMeter           = NULL;
+
+                vSend[i]            = NULL;
+            }
+
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
 
-                c->sBypass.construct();
+                c->sDelay.construct();
+                c->nSilence         = 0;
+                c->nNonFinite       = 0;
+                c->nDenormal        = 0;
+                c->vTaps            = &vTaps[i * nLinks];
 
                 c->pIn              = NULL;
                 c->pOut             = NULL;
-                c->pSend            = NULL;
+                c->pSidechain       = NULL;
 
                 c->pInMeter         = NULL;
                 c->pOutMeter        = NULL;
-                c->pSendMeter       = NULL;
+                c->pNonFinite       = NULL;
+                c->pDenormal        = NULL;
+
+                vIn[i]              = NULL;
+                vOut[i]             = NULL;
+                vPeak[i]            = 0.0f;
+            }
+
+            // Each tap cascades the high-pass and the low-pass filter in one filter bank
+            for (size_t i=0; i<num_taps; ++i)
+            {
+                tap_t *t            = &vTaps[i];
+                if (!t->sFilter.init(2, 0))
+                    return;
+                t->sFilter.set_mode(dspu::EQM_IIR);
             }
 
             size_t port_id      = 0;
@@ -109,17 +325,51 @@ namespace lsp
                 BIND_PORT(vChannels[i].pIn);
             for (size_t i=0; i<nChannels; ++i)
                 BIND_PORT(vChannels[i].pOut);
+            if (bSidechain)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    BIND_PORT(vChannels[i].pSidechain);
+                BIND_PORT(pGateSc);
+            }
 
             lsp_trace("Binding common ports");
             BIND_PORT(pBypass);
             BIND_PORT(pInGain);
             BIND_PORT(pOutGain);
-            BIND_PORT(pSendGain);
+            BIND_PORT(pDelayMode);
+            BIND_PORT(pReportLatency);
+            BIND_PORT(pScrub);
+            BIND_PORT(pGate);
+            BIND_PORT(pGateThresh);
+            BIND_PORT(pGateAttack);
+            BIND_PORT(pGateRelease);
+            BIND_PORT(pGateMeter);
+            BIND_PORT(pLoudness);
+            BIND_PORT(pConnected);
 
             lsp_trace("Binding send ports");
-            SKIP_PORT("Send name");
-            for (size_t i=0; i<nChannels; ++i)
-                BIND_PORT(vChannels[i].pSend);
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l           = &vLinks[j];
+
+                BIND_PORT(l->pGain);
+                if (nChannels == 2)
+                    BIND_PORT(l->pRouting);
+                BIND_PORT(l->pHpfSlope);
+                BIND_PORT(l->pHpfFreq);
+                BIND_PORT(l->pLpfSlope);
+                BIND_PORT(l->pLpfFreq);
+                BIND_PORT(l->pDelaySamples);
+                BIND_PORT(l->pDelayTime);
+                SKIP_PORT("Send name");
+                for (size_t i=0; i<nChannels; ++i)
+                    BIND_PORT(vChannels[i].vTaps[j].pSend);
+                BIND_PORT(l->pSilent);
+                BIND_PORT(l->pConnState);
+                BIND_PORT(l->pRms);
+                BIND_PORT(l->pMomentary);
+                BIND_PORT(l->pShortTerm);
+            }
 
             lsp_trace("Binding meters");
             for (size_t i=0; i<nChannels; ++i)
@@ -127,9 +377,20 @@ namespace lsp
                 channel_t *c        = &vChannels[i];
 
                 BIND_PORT(c->pInMeter);
-                BIND_PORT(c->pSendMeter);
+                for (size_t j=0; j<nLinks; ++j)
+                    BIND_PORT(c->vTaps[j].pMeter);
                 BIND_PORT(c->pOutMeter);
+                BIND_PORT(c->pNonFinite);
+                BIND_PORT(c->pDenormal);
             }
+            BIND_PORT(pHistory);
+
+        #if LSP_SEND_PROFILING
+            lsp_trace("Binding DSP load meters");
+            BIND_PORT(pProfileMin);
+            BIND_PORT(pProfileAvg);
+            BIND_PORT(pProfileMax);
+        #endif /* LSP_SEND_PROFILING */
         }
 
         void send::destroy()
@@ -140,26 +401,77 @@ namespace lsp
 
         void send::do_destroy()
         {
+            if (vTaps != NULL)
+            {
+                for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+                {
+                    tap_t *t            = &vTaps[i];
+                    t->sBypass.destroy();
+                    t->sDelay.destroy();
+                    t->sFilter.destroy();
+                }
+                vTaps           = NULL;
+            }
+
             if (vChannels != NULL)
             {
                 for (size_t i=0; i<nChannels; ++i)
                 {
                     channel_t *c        = &vChannels[i];
-                    c->sBypass.destroy();
+                    c->sDelay.destroy();
                 }
-
-                free(vChannels);
                 vChannels       = NULL;
             }
+
+            vLinks          = NULL;
+
+            if (pData != NULL)
+            {
+                free_aligned(pData);
+                pData           = NULL;
+            }
+
+            vIn             = NULL;
+            vOut            = NULL;
+            vSend           = NULL;
+            vPeak           = NULL;
+            vActive         = NULL;
+            vActiveGain     = NULL;
+            vGate           = NULL;
         }
 
         void send::update_sample_rate(long sr)
         {
+            // Delay lines are allocated here, so the audio thread never allocates memory
+            const size_t max_delay  = lsp_max(
+                size_t(meta::send::DELAY_SAMPLES_MAX),
+                size_t(dspu::millis_to_samples(sr, meta::send::DELAY_TIME_MAX)));
+
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
-                c->sBypass.init(sr);
+                c->sDelay.init(max_delay);
+                c->nSilence         = 0;
             }
+
+            for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+            {
+                tap_t *t            = &vTaps[i];
+                t->sBypass.init(sr, meta::send::BYPASS_TIME);
+                t->sFilter.set_sample_rate(sr);
+                t->sDelay.init(max_delay);
+            }
+
+            update_loudness();
+
+            // Bypass state has been reset, let it settle with the crossfade
+            nBypassFade             = size_t(dspu::seconds_to_samples(sr, meta::send::BYPASS_TIME)) + 1;
+            nBypassTail             = nBypassFade;
+
+        #if LSP_SEND_PROFILING
+            nProfilePeriod          = size_t(dspu::seconds_to_samples(sr, meta::send::PROFILE_PERIOD));
+            reset_profile(&sWindow);
+        #endif /* LSP_SEND_PROFILING */
         }
 
         void send::update_settings()
@@ -168,38 +480,1155 @@ namespace lsp
 
             fInGain                 = pInGain->value();
             fOutGain                = pOutGain->value() * fInGain;
-            fSendGain               = pSendGain->value() * fInGain;
+            bScrub                  = pScrub->value() >= 0.5f;
+
+            // Send gate starts open when enabled and then follows the key
+            const bool gate         = pGate->value() >= 0.5f;
+            if (gate != bGate)
+            {
+                bGate                   = gate;
+                fGateEnv                = 0.0f;
+                fGateGain               = GAIN_AMP_0_DB;
+                nGateClosed             = 0;
+            }
+            bGateSc                 = (pGateSc != NULL) && (pGateSc->value() >= 0.5f);
+            fGateThresh             = pGateThresh->value();
+            fGateAttack             = smooth_coeff(fSampleRate, pGateAttack->value() * 0.001f);
+            fGateRelease            = smooth_coeff(fSampleRate, pGateRelease->value() * 0.001f);
+            fGateFall               = smooth_coeff(fSampleRate, meta::send::GATE_KEY_RELEASE);
+
+            const bool loudness     = pLoudness->value() >= 0.5f;
+            if (loudness != bLoudness)
+            {
+                bLoudness               = loudness;
+                reset_loudness();
+            }
+
+            // Output is delayed by the maximum latency of return paths, each send is delayed by the
+            // difference between the maximum latency and the latency of its own return path
+            const bool time_mode    = size_t(pDelayMode->value()) == meta::send::DELAY_MODE_TIME;
+            size_t delay            = 0;
+
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l               = &vLinks[j];
+                l->fGain                = l->pGain->value() * fInGain;
+                update_matrix(l);
+                update_filters(j);
+                l->nLatency             = (time_mode) ?
+                    size_t(dspu::millis_to_samples(fSampleRate, l->pDelayTime->value())) :
+                    size_t(l->pDelaySamples->value());
+                delay                   = lsp_max(delay, l->nLatency);
+            }
+
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l               = &vLinks[j];
+                const size_t send_delay = delay - l->nLatency;
+                if ((l->nDelay <= 0) && (send_delay > 0))
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                        vChannels[i].vTaps[j].sDelay.clear();
+                }
+                l->nDelay               = send_delay;
+
+                for (size_t i=0; i<nChannels; ++i)
+                    vChannels[i].vTaps[j].sDelay.set_delay(l->nDelay);
+            }
 
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c            = &vChannels[i];
+                if ((nDelay <= 0) && (delay > 0))
+                    c->sDelay.clear();
+                c->sDelay.set_delay(delay);
+            }
+            nDelay                  = delay;
+
+            set_latency((pReportLatency->value() >= 0.5f) ? nDelay : 0);
+
+            if (bypass != bBypass)
+            {
+                bBypass                 = bypass;
+                nBypassTail             = nBypassFade;
+            }
+
+            for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+            {
+                tap_t *t            = &vTaps[i];
+                t->sBypass.set_bypass(bypass);
+            }
+
+            bind_sends();
+            sync_sends();
+            select_fast();
+        }
+
+        void send::bind_sends()
+        {
+            // Send buffers are owned by the ports and stay bound to them, only the connection changes
+            bool changed            = false;
+            for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+            {
+                tap_t *t            = &vTaps[i];
+                core::AudioBuffer *buf  = (t->pSend != NULL) ? t->pSend->buffer<core::AudioBuffer>() : NULL;
+                changed                 = changed || (buf != t->pSendBuf);
+                t->pSendBuf             = buf;
+            }
+
+            if (changed)
+                update_connections();
+        }
+
+        void send::sync_sends()
+        {
+            // The module API has no callback for connection changes: the wrapper toggles activity of
+            // the send buffer between blocks without updating settings. Cached flags are compared with
+            // the buffer state on each block, everything else is derived on the change
+            for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+            {
+                const tap_t *t      = &vTaps[i];
+                const bool connected    = (t->pSendBuf != NULL) && (t->pSendBuf->active());
+                if (connected != t->bConnected)
+                {
+                    update_connections();
+                    return;
+                }
+            }
+        }
+
+        void send::update_connections()
+        {
+            nConnected              = 0;
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l           = &vLinks[j];
+                l->nConnected       = 0;
+
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    tap_t *t            = &vChannels[i].vTaps[j];
+                    const bool connected    = (t->pSendBuf != NULL) && (t->pSendBuf->active());
+
+                    // Contents of the buffer are unknown after the connection has changed
+                    if (connected != t->bConnected)
+                    {
+                        t->bConnected       = connected;
+                        t->pZero            = NULL;
+                        t->nZero            = 0;
+                    }
+                    if (connected)
+                        ++l->nConnected;
+                }
+                nConnected         += l->nConnected;
+
+                if (l->pConnState != NULL)
+                {
+                    const size_t state  =
+                        (l->nConnected <= 0) ? meta::send::CONN_NONE :
+                        (l->nConnected < nChannels) ? meta::send::CONN_PARTIAL :
+                        meta::send::CONN_FULL;
+                    l->pConnState->set_value(state);
+                }
+            }
+
+            if (pConnected != NULL)
+                pConnected->set_value(nConnected);
+
+            ++nConnEvents;
+            select_fast();
+        }
+
+        template <size_t CHANNELS>
+        send::process_t send::fast_routine(size_t state)
+        {
+            switch (state)
+            {
+                case FAST_ACTIVE:   return &send::process_fast<CHANNELS, FAST_ACTIVE>;
+                case FAST_INACTIVE: return &send::process_fast<CHANNELS, FAST_INACTIVE>;
+                case FAST_BYPASS:   return &send::process_fast<CHANNELS, FAST_BYPASS>;
+                default: break;
+            }
+            return NULL;
+        }
+
+        void send::select_fast()
+        {
+            pFast                   = NULL;
+
+            // Specialised routines cover only the configuration without optional processing stages
+            if ((bScrub) || (bGate) || (bLoudness) || (nDelay > 0))
+                return;
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                const link_t *l     = &vLinks[j];
+                if ((l->nDelay > 0) || (l->bFilter) || (l->bMatrix))
+                    return;
+            }
+
+            size_t state;
+            if (bBypass)
+                state                   = FAST_BYPASS;
+            else if (nConnected <= 0)
+                state                   = FAST_INACTIVE;
+            else if ((nLinks == 1) && (vLinks[0].nConnected >= nChannels) && (vLinks[0].fGain > 0.0f))
+                state                   = FAST_ACTIVE;
+            else
+                return;
+
+            // Specialised routines write only buffers of the active send
+            if (state != FAST_ACTIVE)
+            {
+                for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+                    vSend[i]                = NULL;
+            }
+
+            switch (nChannels)
+            {
+                case 1:     pFast = fast_routine<1>(state); break;
+                case 2:     pFast = fast_routine<2>(state); break;
+                default:    pFast = fast_routine<0>(state); break;
+            }
+        }
+
+        void send::update_parking(size_t samples)
+        {
+            const bool fused        = (!bBypass) && (nBypassTail == 0);
+            const bool bypassed     = (bBypass) && (nBypassTail == 0);
+
+            // Sends which are bypassed or muted after the crossfade has settled are parked: their
+            // buffers are cleared once and then excluded from processing. The muted send is parked
+            // only after its gain has been ramped down, the gated send after it has been flushed
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l           = &vLinks[j];
+                const bool gated    = (bGate) && (nGateClosed >= l->nDelay + l->nTail + samples);
+                const bool parked   = (bypassed) || (gated) || ((fused) && (l->fGain <= 0.0f) && (l->fOldGain <= 0.0f));
+
+                // Delay lines and filters were not processed while parked, drop their outdated contents
+                if ((l->bParked) && (!parked) && (l->nDelay > 0))
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                        vChannels[i].vTaps[j].sDelay.clear();
+                }
+                if ((l->bParked) && (!parked) && (l->bFilter))
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                        vChannels[i].vTaps[j].sFilter.reset();
+                }
+                l->bParked          = parked;
+            }
+        }
+
+        void send::process_silence(channel_t *c, float **sends, size_t samples)
+        {
+            const size_t channel    = c - vChannels;
+            const float *in         = vIn[channel];
+            float *out              = vOut[channel];
+            const size_t silence    = lsp_min(c->nSilence + samples, SILENCE_MAX);
+            const bool fused        = (!bBypass) && (nBypassTail == 0);
+
+            c->nSilence             = silence;
+
+            // Output buffer belongs to the host and should be written on each block
+            if (out != in)
+                dsp::fill_zero(out, samples);
+
+            // Send buffer is filled with zeros once, until something is written to it again.
+            // While the delay line still contains signal, the send is cleared on each block
+            for (size_t j=0; (fused) && (j<nLinks); ++j)
+            {
+                tap_t *t                = &c->vTaps[j];
+                float *send             = sends[j];
+                if ((send == NULL) || (vLinks[j].bMatrix))
+                    continue;
+
+                if (silence < vLinks[j].nDelay + vLinks[j].nTail + samples)
+                {
+                    dsp::fill_zero(send, samples);
+                    t->nZero                = 0;
+                }
+                else
+                    clear_send(t, send, samples);
+            }
+        }
+
+        void send::update_matrix(link_t *l)
+        {
+            // Elements are gains of L->L, R->L, L->R and R->R paths
+            const size_t routing    = (l->pRouting != NULL) ? size_t(l->pRouting->value()) : size_t(meta::send::ROUTING_STEREO);
+            const float k           = l->fGain;
+            const float h           = 0.5f * k;
+
+            switch (routing)
+            {
+                case meta::send::ROUTING_SWAP:
+                    l->vMatrix[0]       = 0.0f;
+                    l->vMatrix[1]       = k;
+                    l->vMatrix[2]       = k;
+                    l->vMatrix[3]       = 0.0f;
+                    break;
+                case meta::send::ROUTING_MONO:
+                    l->vMatrix[0]       = h;
+                    l->vMatrix[1]       = h;
+                    l->vMatrix[2]       = h;
+                    l->vMatrix[3]       = h;
+                    break;
+                case meta::send::ROUTING_MID_SIDE:
+                    l->vMatrix[0]       = h;
+                    l->vMatrix[1]       = h;
+                    l->vMatrix[2]       = h;
+                    l->vMatrix[3]       = -h;
+                    break;
+                case meta::send::ROUTING_SIDE:
+                    l->vMatrix[0]       = h;
+                    l->vMatrix[1]       = -h;
+                    l->vMatrix[2]       = h;
+                    l->vMatrix[3]       = -h;
+                    break;
+                case meta::send::ROUTING_STEREO:
+                default:
+                    l->vMatrix[0]       = k;
+                    l->vMatrix[1]       = 0.0f;
+                    l->vMatrix[2]       = 0.0f;
+                    l->vMatrix[3]       = k;
+                    break;
+            }
+
+            // Straight stereo routing is processed by the per-channel path. After switching to it,
+            // the matrix is still used until the crossfade from the previous routing completes
+            const float *om         = l->vOldMatrix;
+            const float *m          = l->vMatrix;
+            const bool changed      = (om[0] != m[0]) || (om[1] != m[1]) || (om[2] != m[2]) || (om[3] != m[3]);
+            l->bRouted              = (nChannels == 2) && (routing != meta::send::ROUTING_STEREO);
+            l->bMatrix              = (l->bRouted) || ((nChannels == 2) && (l->bMatrix) && (changed));
+        }
+
+        void send::update_filters(size_t link)
+        {
+            link_t *l               = &vLinks[link];
+            const size_t hps        = size_t(l->pHpfSlope->value());
+            const size_t lps        = size_t(l->pLpfSlope->value());
+            dspu::filter_params_t fp;
+
+            // Slope of each step is 12 dB/oct, so the slope index is the number of second-order sections
+            l->bFilter              = (hps != meta::send::SLOPE_OFF) || (lps != meta::send::SLOPE_OFF);
+            l->nTail                = (l->bFilter) ? size_t(dspu::seconds_to_samples(fSampleRate, meta::send::FILTER_TAIL)) : 0;
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                dspu::Equalizer *eq     = &vChannels[i].vTaps[link].sFilter;
+
+                fp.nType                = (hps != meta::send::SLOPE_OFF) ? dspu::FLT_BT_BWC_HIPASS : dspu::FLT_NONE;
+                fp.fFreq                = l->pHpfFreq->value();
+                fp.fFreq2               = fp.fFreq;
+                fp.fGain                = GAIN_AMP_0_DB;
+                fp.nSlope               = hps;
+                fp.fQuality             = 0.0f;
+                eq->set_params(0, &fp);
+
+                fp.nType                = (lps != meta::send::SLOPE_OFF) ? dspu::FLT_BT_BWC_LOPASS : dspu::FLT_NONE;
+                fp.fFreq                = l->pLpfFreq->value();
+                fp.fFreq2               = fp.fFreq;
+                fp.nSlope               = lps;
+                eq->set_params(1, &fp);
+            }
+        }
+
+        void send::process_filters(size_t samples)
+        {
+            // Filters are applied to the send buffer only, the send which is known to contain silence
+            // is skipped after the filters have rung out
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                const link_t *l     = &vLinks[j];
+                if (!l->bFilter)
+                    continue;
+
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    float *send         = vSend[i * nLinks + j];
+                    if ((send == NULL) || ((!l->bMatrix) && (c->nSilence >= l->nTail + samples)))
+                        continue;
+
+                    c->vTaps[j].sFilter.process(send, send, samples);
+                }
+            }
+        }
+
+        void send::process_matrix(size_t link, bool fused, size_t samples)
+        {
+            const link_t *l         = &vLinks[link];
+            tap_t *tl               = &vChannels[0].vTaps[link];
+            tap_t *tr               = &vChannels[1].vTaps[link];
+            float *dl               = vSend[link];
+            float *dr               = vSend[nLinks + link];
+            const float *om         = l->vOldMatrix;
+            const float *m          = l->vMatrix;
+
+            // While the matrix changes, each element is ramped across the block. Otherwise
+            // both send channels are computed in one pass over both inputs
+            if ((om[0] != m[0]) || (om[1] != m[1]) || (om[2] != m[2]) || (om[3] != m[3]))
+            {
+                const size_t tail       = nBlockOffset + samples;
+                float vs[4], ve[4];
+                for (size_t k=0; k<4; ++k)
+                {
+                    vs[k]                   = ramp_value(om[k], m[k], nBlockOffset, nBlockSize);
+                    ve[k]                   = ramp_value(om[k], m[k], tail, nBlockSize);
+                }
+
+                if (dl != NULL)
+                {
+                    dsp::lramp2(dl, vIn[0], vs[0], ve[0], samples);
+                    dsp::lramp_add2(dl, vIn[1], vs[1], ve[1], samples);
+                }
+                if (dr != NULL)
+                {
+                    dsp::lramp2(dr, vIn[0], vs[2], ve[2], samples);
+                    dsp::lramp_add2(dr, vIn[1], vs[3], ve[3], samples);
+                }
+            }
+            else if ((dl != NULL) && (dr != NULL))
+                send_dsp::matrix(dl, dr, vIn[0], vIn[1], l->vMatrix, samples);
+            else if (dl != NULL)
+                dsp::mix_copy2(dl, vIn[0], vIn[1], l->vMatrix[0], l->vMatrix[1], samples);
+            else if (dr != NULL)
+                dsp::mix_copy2(dr, vIn[0], vIn[1], l->vMatrix[2], l->vMatrix[3], samples);
+
+            // The matrix already contains the send gain
+            if (dl != NULL)
+            {
+                if (!fused)
+                    tl->sBypass.process_wet(dl, NULL, dl, 1.0f, samples);
+                tl->nZero               = 0;
+            }
+            if (dr != NULL)
+            {
+                if (!fused)
+                    tr->sBypass.process_wet(dr, NULL, dr, 1.0f, samples);
+                tr->nZero               = 0;
+            }
+        }
+
+        float send::process_ramp(size_t channel, float **sends, bool fused, size_t samples)
+        {
+            const float *in         = vIn[channel];
+            float *out              = vOut[channel];
+            const float peak        = dsp::abs_max(in, samples);
+            const size_t tail       = nBlockOffset + samples;
+
+            // Gains are ramped linearly from the values applied at the end of the previous block,
+            // sends are written first since input may alias output
+            for (size_t j=0; (fused) && (j<nLinks); ++j)
+            {
+                const link_t *l         = &vLinks[j];
+                if ((sends[j] != NULL) && (!l->bMatrix))
+                    dsp::lramp2(sends[j], in,
+                        ramp_value(l->fOldGain, l->fGain, nBlockOffset, nBlockSize),
+                        ramp_value(l->fOldGain, l->fGain, tail, nBlockSize),
+                        samples);
+            }
+            dsp::lramp2(out, in,
+                ramp_value(fOldOutGain, fOutGain, nBlockOffset, nBlockSize),
+                ramp_value(fOldOutGain, fOutGain, tail, nBlockSize),
+                samples);
+
+            return peak;
+        }
+
+        void send::commit_gains()
+        {
+            bool unrouted           = false;
+
+            fOldOutGain             = fOutGain;
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l               = &vLinks[j];
+                l->fOldGain             = l->fGain;
+                for (size_t k=0; k<4; ++k)
+                    l->vOldMatrix[k]        = l->vMatrix[k];
+
+                // The crossfade to the straight stereo routing has completed
+                if ((l->bMatrix) && (!l->bRouted))
+                {
+                    l->bMatrix              = false;
+                    unrouted                = true;
+                }
+            }
+
+            if (unrouted)
+                select_fast();
+        }
+
+        void send::process_scrub(size_t samples)
+        {
+            // Signals are sanitized before they reach filters, delay lines and the shared memory,
+            // the send buffer which is known to contain silence is skipped
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
-                c->sBypass.set_bypass(bypass);
+                float **sends       = &vSend[i * nLinks];
+
+                send_dsp::sanitize(vOut[i], &c->nNonFinite, &c->nDenormal, samples);
+                for (size_t j=0; j<nLinks; ++j)
+                {
+                    const tap_t *t      = &c->vTaps[j];
+                    float *send         = sends[j];
+                    if ((send != NULL) && (!send_zero(t, send, samples)))
+                        send_dsp::sanitize(send, &c->nNonFinite, &c->nDenormal, samples);
+                }
             }
         }
 
-        void send::process(size_t samples)
+        const float *send::gate_key(size_t channel) const
+        {
+            const channel_t *c      = &vChannels[channel];
+            const float *sc         = ((bGateSc) && (c->pSidechain != NULL)) ? c->pSidechain->buffer<float>() : NULL;
+            return (sc != NULL) ? sc : c->pIn->buffer<float>();
+        }
+
+        void send::update_gate(size_t offset, size_t samples)
+        {
+            // The closed gate stays closed while the key stays below the threshold, so the key is
+            // checked with a read-only pass before the sends are computed. The envelope of the key
+            // is replaced by its peak which is also below the threshold
+            bool closed             = fGateGain <= 0.0f;
+            float peak              = 0.0f;
+            for (size_t i=0; (closed) && (i<nChannels); ++i)
+            {
+                peak                    = lsp_max(peak, dsp::abs_max(&gate_key(i)[offset], samples));
+                closed                  = peak < fGateThresh;
+            }
+
+            if (closed)
+            {
+                fGateEnv                = peak;
+                nGateClosed             = lsp_min(nGateClosed + samples, SILENCE_MAX);
+                return;
+            }
+            nGateClosed             = 0;
+
+            // The key is taken before the output pass since the output may alias the input. Keys
+            // of all channels are linked, so the gate does not shift the stereo image
+            dsp::abs2(vGate, &gate_key(0)[offset], samples);
+            for (size_t i=1; i<nChannels; ++i)
+                send_dsp::abs_max2(vGate, &gate_key(i)[offset], samples);
+        }
+
+        void send::process_gate(size_t samples)
+        {
+            const size_t num_taps   = nChannels * nLinks;
+
+            // The gate is closed during the whole block but the sends are not parked yet, so
+            // zeros are passed to filters and delay lines to flush them
+            if (nGateClosed > 0)
+            {
+                for (size_t i=0; i<num_taps; ++i)
+                {
+                    const tap_t *t      = &vTaps[i];
+                    float *send         = vSend[i];
+                    if ((send != NULL) && (!send_zero(t, send, samples)))
+                        dsp::fill_zero(send, samples);
+                }
+                return;
+            }
+
+            float env               = fGateEnv;
+            float gain              = fGateGain;
+
+            // Key envelope has instant attack, the gain follows the open/closed state of the gate.
+            // The key has been stored by update_gate() and is replaced by the gain
+            for (size_t k=0; k<samples; ++k)
+            {
+                const float x       = vGate[k];
+                env                 = (x > env) ? x : env + (x - env) * fGateFall;
+                const float target  = (env >= fGateThresh) ? 1.0f : 0.0f;
+                gain               += (target - gain) * ((target > gain) ? fGateAttack : fGateRelease);
+                if (gain < GATE_FLOOR)
+                    gain                = 0.0f;
+                vGate[k]            = gain;
+            }
+
+            for (size_t i=0; i<num_taps; ++i)
+            {
+                const tap_t *t      = &vTaps[i];
+                float *send         = vSend[i];
+                if ((send != NULL) && (!send_zero(t, send, samples)))
+                    dsp::mul2(send, vGate, samples);
+            }
+
+            fGateEnv                = env;
+            fGateGain               = gain;
+        }
+
+        void send::update_loudness()
+        {
+            // Input of the loudness meter is decimated by picking each N'th sample. This keeps the energy
+            // of the signal, and the components above the decimated Nyquist frequency are aliased into
+            // the range where the K-weighting curve is almost flat
+            nLoudStep               = lsp_max(size_t(fSampleRate / meta::send::LOUDNESS_RATE), size_t(1));
+            const double sr         = double(fSampleRate) / nLoudStep;
+            nLoudBlock              = lsp_max(size_t(sr * meta::send::LOUDNESS_BLOCK), size_t(1));
+
+            // K-weighting filters of ITU-R BS.1770 designed for the decimated sample rate:
+            // the high shelf which models the head and the RLB high-pass filter
+            const double vh         = pow(10.0, 3.999843853973347 / 20.0);
+            const double vb         = pow(vh, 0.4996667741545416);
+            double q                = 0.7071752369554196;
+            double k                = tan(M_PI * 1681.974450955533 / sr);
+            double a0               = 1.0 + k / q + k * k;
+            vKCoeff[0]              = (vh + vb * k / q + k * k) / a0;
+            vKCoeff[1]              = 2.0 * (k * k - vh) / a0;
+            vKCoeff[2]              = (vh - vb * k / q + k * k) / a0;
+            vKCoeff[3]              = 2.0 * (k * k - 1.0) / a0;
+            vKCoeff[4]              = (1.0 - k / q + k * k) / a0;
+
+            q                       = 0.5003270373238773;
+            k                       = tan(M_PI * 38.13547087602444 / sr);
+            a0                      = 1.0 + k / q + k * k;
+            vKCoeff[5]              = 1.0f;
+            vKCoeff[6]              = -2.0f;
+            vKCoeff[7]              = 1.0f;
+            vKCoeff[8]              = 2.0 * (k * k - 1.0) / a0;
+            vKCoeff[9]              = (1.0 - k / q + k * k) / a0;
+
+            reset_loudness();
+        }
+
+        void send::reset_loudness()
+        {
+            nLoudPhase              = 0;
+
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l               = &vLinks[j];
+                l->fLoudSum             = 0.0f;
+                l->fRmsSum              = 0.0f;
+                l->nLoudCount           = 0;
+                l->nLoudHead            = 0;
+                for (size_t k=0; k<meta::send::LOUDNESS_SHORT_TERM; ++k)
+                    l->vLoudHist[k]         = 0.0f;
+                for (size_t k=0; k<meta::send::LOUDNESS_MOMENTARY; ++k)
+                    l->vRmsHist[k]          = 0.0f;
+            }
+
+            for (size_t i=0, n=nChannels * nLinks; i<n; ++i)
+            {
+                tap_t *t                = &vTaps[i];
+                for (size_t k=0; k<4; ++k)
+                    t->vKState[k]           = 0.0f;
+            }
+        }
+
+        void send::measure(tap_t *t, link_t *l, const float *k, const float *src, size_t step, size_t count)
+        {
+            float s0                = t->vKState[0];
+            float s1                = t->vKState[1];
+            float s2                = t->vKState[2];
+            float s3                = t->vKState[3];
+            float ksum              = 0.0f;
+            float rsum              = 0.0f;
+
+            // Two biquad filters in transposed direct form II
+            for (size_t i=0; i<count; ++i, src += step)
+            {
+                const float x           = *src;
+                const float y           = k[0] * x + s0;
+                s0                      = k[1] * x - k[3] * y + s1;
+                s1                      = k[2] * x - k[4] * y;
+                const float z           = k[5] * y + s2;
+                s2                      = k[6] * y - k[8] * z + s3;
+                s3                      = k[7] * y - k[9] * z;
+
+                ksum                   += z * z;
+                rsum                   += x * x;
+            }
+
+            t->vKState[0]           = s0;
+            t->vKState[1]           = s1;
+            t->vKState[2]           = s2;
+            t->vKState[3]           = s3;
+            l->fLoudSum            += ksum;
+            l->fRmsSum             += rsum;
+        }
+
+        void send::process_loudness(size_t samples)
+        {
+            // Positions of decimated samples continue from the previous block
+            const size_t phase      = nLoudPhase;
+            const size_t count      = (samples > phase) ? (samples - phase + nLoudStep - 1) / nLoudStep : 0;
+            nLoudPhase              = phase + count * nLoudStep - samples;
+
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l               = &vLinks[j];
+
+                for (size_t done=0; done < count; )
+                {
+                    const size_t to_do      = lsp_min(count - done, nLoudBlock - l->nLoudCount);
+                    const size_t offset     = phase + done * nLoudStep;
+
+                    // Sends which are not connected or known to contain silence add no energy
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        tap_t *t                = &vChannels[i].vTaps[j];
+                        const float *send       = vSend[i * nLinks + j];
+                        if ((send == NULL) || (send_zero(t, send, samples)))
+                            continue;
+                        measure(t, l, vKCoeff, &send[offset], nLoudStep, to_do);
+                    }
+
+                    l->nLoudCount          += to_do;
+                    done                   += to_do;
+                    if (l->nLoudCount < nLoudBlock)
+                        continue;
+
+                    // Store mean energy of the complete block, the energy of channels is summed
+                    const float norm        = 1.0f / nLoudBlock;
+                    l->vLoudHist[l->nLoudHead % meta::send::LOUDNESS_SHORT_TERM]    = l->fLoudSum * norm;
+                    l->vRmsHist[l->nLoudHead % meta::send::LOUDNESS_MOMENTARY]      = l->fRmsSum * norm;
+                    l->nLoudHead            = (l->nLoudHead + 1) % (meta::send::LOUDNESS_SHORT_TERM * meta::send::LOUDNESS_MOMENTARY);
+                    l->fLoudSum             = 0.0f;
+                    l->fRmsSum              = 0.0f;
+                    l->nLoudCount           = 0;
+                }
+            }
+        }
+
+        static inline float energy_to_lufs(float energy)
+        {
+            const float lufs        = (energy > 0.0f) ? -0.691f + 10.0f * log10f(energy) : meta::send::LUFS_MIN;
+            return lsp_limit(lufs, meta::send::LUFS_MIN, meta::send::LUFS_MAX);
+        }
+
+        void send::output_loudness()
+        {
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                const link_t *l         = &vLinks[j];
+                float rms               = 0.0f;
+                float momentary         = 0.0f;
+                float short_term        = 0.0f;
+
+                if (bLoudness)
+                {
+                    for (size_t k=0; k<meta::send::LOUDNESS_MOMENTARY; ++k)
+                        rms                    += l->vRmsHist[k];
+                    for (size_t k=0; k<meta::send::LOUDNESS_SHORT_TERM; ++k)
+                    {
+                        // Momentary loudness takes the most recent blocks of the short-term window
+                        const size_t age        = (l->nLoudHead + meta::send::LOUDNESS_SHORT_TERM - k - 1) % meta::send::LOUDNESS_SHORT_TERM;
+                        if (age < meta::send::LOUDNESS_MOMENTARY)
+                            momentary              += l->vLoudHist[k];
+                        short_term             += l->vLoudHist[k];
+                    }
+
+                    rms                     = sqrtf(rms / (meta::send::LOUDNESS_MOMENTARY * nChannels));
+                    momentary              /= meta::send::LOUDNESS_MOMENTARY;
+                    short_term             /= meta::send::LOUDNESS_SHORT_TERM;
+                }
+
+                if (l->pRms != NULL)
+                    l->pRms->set_value(rms);
+                if (l->pMomentary != NULL)
+                    l->pMomentary->set_value(energy_to_lufs(momentary));
+                if (l->pShortTerm != NULL)
+                    l->pShortTerm->set_value(energy_to_lufs(short_term));
+            }
+        }
+
+        bool send::send_zero(const tap_t *t, const float *send, size_t samples) const
+        {
+            // Silence is tracked from the start of the send buffer, the block may be processed in chunks
+            return (t->pZero != NULL) && (&t->pZero[nBlockOffset] == send) && (t->nZero >= nBlockOffset + samples);
+        }
+
+        void send::clear_send(tap_t *t, float *send, size_t samples)
+        {
+            if (send_zero(t, send, samples))
+                return;
+
+            dsp::fill_zero(send, samples);
+
+            // The cleared chunk extends the silent part of the buffer only if it follows it
+            if (nBlockOffset <= 0)
+            {
+                t->pZero                = send;
+                t->nZero                = samples;
+            }
+            else if ((t->pZero != NULL) && (&t->pZero[nBlockOffset] == send) && (t->nZero >= nBlockOffset))
+                t->nZero                = nBlockOffset + samples;
+        }
+
+    #if LSP_SEND_PROFILING
+        void send::reset_profile(profile_t *p)
+        {
+            p->nCalls               = 0;
+            p->nSamples             = 0;
+            p->nTotal               = 0;
+            p->nMin                 = 0;
+            p->nMax                 = 0;
+        }
+
+        void send::account_profile(profile_t *p, uint64_t time, size_t samples)
+        {
+            p->nMin                 = (p->nCalls > 0) ? lsp_min(p->nMin, time) : time;
+            p->nMax                 = lsp_max(p->nMax, time);
+            p->nTotal              += time;
+            p->nSamples            += samples;
+            ++p->nCalls;
+        }
+
+        void send::update_profile(const system::time_t *start, size_t samples)
+        {
+            system::time_t ts;
+            system::get_time(&ts);
+
+            const int64_t time      = (int64_t(ts.seconds) - int64_t(start->seconds)) * 1000000000 + (int64_t(ts.nanos) - int64_t(start->nanos));
+            const uint64_t ns       = lsp_max(time, int64_t(0));
+            account_profile(&sProfile, ns, samples);
+            account_profile(&sWindow, ns, samples);
+
+            // Meters are updated periodically to keep them readable
+            if (sWindow.nSamples < nProfilePeriod)
+                return;
+
+            if (pProfileMin != NULL)
+                pProfileMin->set_value(sWindow.nMin * 1e-6f);
+            if (pProfileAvg != NULL)
+                pProfileAvg->set_value((sWindow.nTotal / sWindow.nCalls) * 1e-6f);
+            if (pProfileMax != NULL)
+                pProfileMax->set_value(sWindow.nMax * 1e-6f);
+
+            reset_profile(&sWindow);
+        }
+
+        void send::dump_profile(dspu::IStateDumper *v, const char *name, const profile_t *p)
+        {
+            v->begin_object(name, p, sizeof(profile_t));
+            {
+                v->write("nCalls", p->nCalls);
+                v->write("nSamples", p->nSamples);
+                v->write("nTotal", p->nTotal);
+                v->write("nMin", p->nMin);
+                v->write("nAvg", (p->nCalls > 0) ? p->nTotal / p->nCalls : 0);
+                v->write("nMax", p->nMax);
+            }
+            v->end_object();
+        }
+    #endif /* LSP_SEND_PROFILING */
+
+        template <size_t CHANNELS, size_t STATE>
+        void send::process_fast(size_t samples)
+        {
+            // The number of channels is known at compile time except the generic multichannel case,
+            // the only send link has index 0 in the active state
+            const size_t channels   = (CHANNELS > 0) ? CHANNELS : nChannels;
+            const float gain        = (STATE == FAST_ACTIVE) ? vLinks[0].fGain : 0.0f;
+            const float out_gain    = fOutGain;
+
+            // Parking state is shared with the generic path, so the silence of sends is reported the same way
+            update_parking(samples);
+
+            // Buffers of all channels are resolved once before the processing loop
+            for (size_t i=0; i<channels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                float **sends       = &vSend[i * nLinks];
+
+                vIn[i]              = c->pIn->buffer<float>();
+                vOut[i]             = c->pOut->buffer<float>();
+
+                for (size_t j=0; j<nLinks; ++j)
+                {
+                    tap_t *t            = &c->vTaps[j];
+                    sends[j]            = (STATE == FAST_ACTIVE) ? t->pSendBuf->buffer() : NULL;
+
+                    // Parked sends are cleared once after they have been connected
+                    if ((STATE == FAST_BYPASS) && (t->bConnected))
+                        clear_send(t, t->pSendBuf->buffer(), samples);
+                }
+            }
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                const float *in     = vIn[i];
+                float *out          = vOut[i];
+                float *send         = vSend[i * nLinks];
+
+                // After a silent block, check the input with a read-only pass before writing anything
+                if ((c->nSilence > 0) && (dsp::abs_max(in, samples) <= 0.0f))
+                {
+                    process_silence(c, &vSend[i * nLinks], samples);
+                    vPeak[i]            = 0.0f;
+                    continue;
+                }
+
+                vPeak[i]            = (in == out) ?
+                    send_dsp::process_inplace(out, send, out_gain, gain, samples) :
+                    send_dsp::process(out, send, in, out_gain, gain, samples);
+
+                if (STATE == FAST_ACTIVE)
+                    c->vTaps[0].nZero   = 0;
+                c->nSilence         = (vPeak[i] <= 0.0f) ? lsp_min(c->nSilence + samples, SILENCE_MAX) : 0;
+            }
+        }
+
+        void send::process_generic(bool ramp, size_t samples)
         {
+            // The send signal can be computed in the same pass with output only if bypass has settled
+            const bool fused        = (!bBypass) && (nBypassTail == 0);
+            const size_t offset     = nBlockOffset;
+
+            // Check if the send gate stays closed during this block
+            if (bGate)
+                update_gate(offset, samples);
+            update_parking(samples);
+
+            // Fetch buffers of all channels
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                float **sends       = &vSend[i * nLinks];
+
+                vIn[i]              = &c->pIn->buffer<float>()[offset];
+                vOut[i]             = &c->pOut->buffer<float>()[offset];
+
+                for (size_t j=0; j<nLinks; ++j)
+                {
+                    tap_t *t            = &c->vTaps[j];
+                    sends[j]            = (t->bConnected) ? &t->pSendBuf->buffer()[offset] : NULL;
+
+                    if ((sends[j] != NULL) && (vLinks[j].bParked))
+                    {
+                        clear_send(t, sends[j], samples);
+                        sends[j]            = NULL;
+                    }
+                }
+            }
+
+            // Routing matrix and crossfade should be applied before the output is written since
+            // input may alias output
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                if (vLinks[j].bMatrix)
+                    process_matrix(j, fused, samples);
+            }
+
+            if (!fused)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    float **sends       = &vSend[i * nLinks];
+
+                    for (size_t j=0; j<nLinks; ++j)
+                    {
+                        tap_t *t            = &c->vTaps[j];
+                        if ((sends[j] == NULL) || (vLinks[j].bMatrix))
+                            continue;
+                        t->sBypass.process_wet(sends[j], NULL, vIn[i], vLinks[j].fGain, samples);
+                        t->nZero            = 0;
+                    }
+                }
+            }
+
+            // Compute output, sends and input peak in one pass
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                float **sends       = &vSend[i * nLinks];
+                const float *in     = vIn[i];
+                float *out          = vOut[i];
+                float peak          = 0.0f;
+
+                // After a silent block, check the input with a read-only pass before writing anything
+                if ((c->nSilence > 0) && (dsp::abs_max(in, samples) <= 0.0f))
+                    process_silence(c, sends, samples);
+                else
+                {
+                    if (ramp)
+                        peak                = process_ramp(i, sends, fused, samples);
+                    else
+                    {
+                        // Inactive sends are excluded from processing
+                        size_t active       = 0;
+                        for (size_t j=0; (fused) && (j<nLinks); ++j)
+                        {
+                            if ((sends[j] == NULL) || (vLinks[j].bMatrix))
+                                continue;
+                            vActive[active]     = sends[j];
+                            vActiveGain[active] = vLinks[j].fGain;
+                            ++active;
+                        }
+
+                        if (active > 1)
+                            peak                = send_dsp::fanout(out, vActive, in, fOutGain, vActiveGain, active, samples);
+                        else
+                        {
+                            float *send         = (active > 0) ? vActive[0] : NULL;
+                            peak                = (in == out) ?
+                                send_dsp::process_inplace(out, send, fOutGain, vActiveGain[0], samples) :
+                                send_dsp::process(out, send, in, fOutGain, vActiveGain[0], samples);
+                        }
+                    }
+
+                    for (size_t j=0; (fused) && (j<nLinks); ++j)
+                        c->vTaps[j].nZero   = 0;
+                    c->nSilence         = (peak <= 0.0f) ? lsp_min(c->nSilence + samples, SILENCE_MAX) : 0;
+                }
+
+                // Meters show the peak of the whole block
+                vPeak[i]            = (offset > 0) ? lsp_max(vPeak[i], peak) : peak;
+            }
+
+            // Replace non-finite and denormal values
+            if (bScrub)
+                process_scrub(samples);
+
+            // Apply the send gate
+            if (bGate)
+                process_gate(samples);
+
+            // Apply send filters before the delay to keep the delay stage the last one
+            process_filters(samples);
+
+            // Apply latency compensation, delay lines which contain only silence are not processed
             for (size_t i=0; i<nChannels; ++i)
             {
                 channel_t *c        = &vChannels[i];
-                const float *in     = c->pIn->buffer<float>();
-                float *out          = c->pOut->buffer<float>();
+                if ((nDelay > 0) && (c->nSilence < nDelay + samples))
+                    c->sDelay.process(vOut[i], vOut[i], samples);
+            }
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l           = &vLinks[j];
+                if (l->nDelay <= 0)
+                    continue;
 
-                core::AudioBuffer *send_buf = c->pSend->buffer<core::AudioBuffer>();
-                float *send         = ((send_buf != NULL) && (send_buf->active())) ? send_buf->buffer() : NULL;
+                // Each channel of the matrix send mixes both inputs, so it is not silent until all inputs are
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    float *send         = vSend[i * nLinks + j];
+                    if ((send == NULL) || ((!l->bMatrix) && (c->nSilence >= l->nDelay + l->nTail + samples)))
+                        continue;
+
+                    c->vTaps[j].sDelay.process(send, send, samples);
+                }
+            }
 
-                const float ilm     = dsp::abs_max(in, samples);
-                dsp::mul_k3(out, in, fOutGain, samples);
-                if (send != NULL)
-                    c->sBypass.process_wet(send, NULL, in, fSendGain, samples);
+            // Measure loudness of sends before they are passed to the consumer
+            if (bLoudness)
+                process_loudness(samples);
+        }
+
+        void send::process(size_t samples)
+        {
+        #if LSP_SEND_PROFILING
+            system::time_t ts_start;
+            system::get_time(&ts_start);
+        #endif /* LSP_SEND_PROFILING */
+
+            // Gains and routing changed since the previous block are ramped across this block, so
+            // automation does not step at block boundaries regardless of the block size
+            bool ramp               = fOldOutGain != fOutGain;
+            for (size_t j=0; (!ramp) && (j<nLinks); ++j)
+            {
+                const link_t *l     = &vLinks[j];
+                const float *om     = l->vOldMatrix;
+                const float *m      = l->vMatrix;
+                ramp                = (l->fOldGain != l->fGain) ||
+                                      (om[0] != m[0]) || (om[1] != m[1]) || (om[2] != m[2]) || (om[3] != m[3]);
+            }
+
+            // Settled blocks of simple configurations are processed by the routine specialised for
+            // the number of channels and the state of sends, everything else takes the generic path
+            sync_sends();
+            nBlockSize              = samples;
+            nBlockOffset            = 0;
+            if ((pFast != NULL) && (!ramp) && (nBypassTail == 0))
+                (this->*pFast)(samples);
+            else
+            {
+                // The key of the send gate is stored before the output pass, so with the gate enabled
+                // the block is split into chunks which fit the key buffer. Ramps span all chunks
+                do
+                {
+                    const size_t to_do  = (bGate) ? lsp_min(samples - nBlockOffset, GATE_CHUNK) : samples - nBlockOffset;
+                    process_generic(ramp, to_do);
+                    nBlockOffset       += to_do;
+                } while (nBlockOffset < samples);
+                nBlockOffset            = 0;
+            }
+
+            // Gains and routing have been applied on any path, next ramps start from them
+            commit_gains();
+
+            // Report the silence of sends
+            for (size_t j=0; j<nLinks; ++j)
+            {
+                link_t *l           = &vLinks[j];
+                bool silent         = true;
+                for (size_t i=0; (!l->bParked) && (silent) && (i<nChannels); ++i)
+                    silent              = vChannels[i].nSilence >= l->nDelay + l->nTail + samples;
+
+                if (l->pSilent != NULL)
+                    l->pSilent->set_value((silent) ? 1.0f : 0.0f);
+            }
+
+            // Update meters. Peaks of each block are also appended to the history stream in the
+            // order of meter ports, so the UI gets peaks of all blocks between its frames
+            plug::stream_t *history = (pHistory != NULL) ? pHistory->buffer<plug::stream_t>() : NULL;
+            size_t series       = 0;
+            if (history != NULL)
+                history->begin(1);
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                const float ilm     = vPeak[i];
+                const float pin     = ilm * fInGain;
+                const float pout    = ilm * fOutGain;
 
                 if (c->pInMeter != NULL)
-                    c->pInMeter->set_value(ilm * fInGain);
-                if (c->pSendMeter != NULL)
-                    c->pSendMeter->set_value(ilm * fSendGain);
+                    c->pInMeter->set_value(pin);
+                if (history != NULL)
+                    history->write_frame(series++, &pin, 0, 1);
+                for (size_t j=0; j<nLinks; ++j)
+                {
+                    tap_t *t            = &c->vTaps[j];
+                    const float peak    = ilm * vLinks[j].fGain;
+                    if (t->pMeter != NULL)
+                        t->pMeter->set_value(peak);
+                    if (history != NULL)
+                        history->write_frame(series++, &peak, 0, 1);
+                }
                 if (c->pOutMeter != NULL)
-                    c->pOutMeter->set_value(ilm * fOutGain);
+                    c->pOutMeter->set_value(pout);
+                if (history != NULL)
+                    history->write_frame(series++, &pout, 0, 1);
+                if (c->pNonFinite != NULL)
+                    c->pNonFinite->set_value(lsp_min(float(c->nNonFinite), meta::send::COUNTER_MAX));
+                if (c->pDenormal != NULL)
+                    c->pDenormal->set_value(lsp_min(float(c->nDenormal), meta::send::COUNTER_MAX));
             }
+
+            if (history != NULL)
+                history->end();
+
+            if (pGateMeter != NULL)
+                pGateMeter->set_value((bGate) ? fGateGain : GAIN_AMP_0_DB);
+            output_loudness();
+
+            nBypassTail            -= lsp_min(nBypassTail, samples);
+
+        #if LSP_SEND_PROFILING
+            update_profile(&ts_start, samples);
+        #endif /* LSP_SEND_PROFILING */
         }
 
         void send::dump(dspu::IStateDumper *v) const
@@ -207,6 +1636,7 @@ namespace lsp
             plug::Module::dump(v);
 
             v->write("nChannels", nChannels);
+            v->write("nLinks", nLinks);
             v->begin_array("vChannels", vChannels, nChannels);
             {
                 for (size_t i=0; i<nChannels; ++i)
@@ -215,29 +1645,158 @@ namespace lsp
 
                     v->begin_object(c, sizeof(channel_t));
                     {
-                        v->write_object("sBypass", &c->sBypass);
+                        v->write_object("sDelay", &c->sDelay);
+                        v->write("nSilence", c->nSilence);
+                        v->write("nNonFinite", c->nNonFinite);
+                        v->write("nDenormal", c->nDenormal);
+                        v->begin_array("vTaps", c->vTaps, nLinks);
+                        {
+                            for (size_t j=0; j<nLinks; ++j)
+                            {
+                                const tap_t *t = &c->vTaps[j];
+
+                                v->begin_object(t, sizeof(tap_t));
+                                {
+                                    v->write_object("sBypass", &t->sBypass);
+                                    v->write_object("sDelay", &t->sDelay);
+                                    v->write_object("sFilter", &t->sFilter);
+                                    v->write("pZero", t->pZero);
+                                    v->write("nZero", t->nZero);
+                                    v->writev("vKState", t->vKState, 4);
+                                    v->write("pSendBuf", t->pSendBuf);
+                                    v->write("bConnected", t->bConnected);
+
+                                    v->write("pSend", t->pSend);
+                                    v->write("pMeter", t->pMeter);
+                                }
+                                v->end_object();
+                            }
+                        }
+                        v->end_array();
 
                         v->write("pIn", c->pIn);
                         v->write("pOut", c->pOut);
-                        v->write("pSend", c->pSend);
+                        v->write("pSidechain", c->pSidechain);
 
                         v->write("pInMeter", c->pInMeter);
                         v->write("pOutMeter", c->pOutMeter);
-                        v->write("pSendMeter", c->pSendMeter);
+                        v->write("pNonFinite", c->pNonFinite);
+                        v->write("pDenormal", c->pDenormal);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+            v->write("vTaps", vTaps);
+            v->begin_array("vLinks", vLinks, nLinks);
+            {
+                for (size_t i=0; i<nLinks; ++i)
+                {
+                    const link_t *l = &vLinks[i];
+
+                    v->begin_object(l, sizeof(link_t));
+                    {
+                        v->write("fGain", l->fGain);
+                        v->write("fOldGain", l->fOldGain);
+                        v->write("nLatency", l->nLatency);
+                        v->write("nDelay", l->nDelay);
+                        v->write("bParked", l->bParked);
+                        v->write("bMatrix", l->bMatrix);
+                        v->write("bRouted", l->bRouted);
+                        v->write("bFilter", l->bFilter);
+                        v->write("nTail", l->nTail);
+                        v->writev("vMatrix", l->vMatrix, 4);
+                        v->writev("vOldMatrix", l->vOldMatrix, 4);
+                        v->write("fLoudSum", l->fLoudSum);
+                        v->write("fRmsSum", l->fRmsSum);
+                        v->write("nLoudCount", l->nLoudCount);
+                        v->write("nLoudHead", l->nLoudHead);
+                        v->writev("vLoudHist", l->vLoudHist, meta::send::LOUDNESS_SHORT_TERM);
+                        v->writev("vRmsHist", l->vRmsHist, meta::send::LOUDNESS_MOMENTARY);
+                        v->write("nConnected", l->nConnected);
+
+                        v->write("pGain", l->pGain);
+                        v->write("pDelaySamples", l->pDelaySamples);
+                        v->write("pDelayTime", l->pDelayTime);
+                        v->write("pRouting", l->pRouting);
+                        v->write("pHpfSlope", l->pHpfSlope);
+                        v->write("pHpfFreq", l->pHpfFreq);
+                        v->write("pLpfSlope", l->pLpfSlope);
+                        v->write("pLpfFreq", l->pLpfFreq);
+                        v->write("pSilent", l->pSilent);
+                        v->write("pConnState", l->pConnState);
+                        v->write("pRms", l->pRms);
+                        v->write("pMomentary", l->pMomentary);
+                        v->write("pShortTerm", l->pShortTerm);
                     }
                     v->end_object();
                 }
             }
             v->end_array();
+            v->write("vIn", vIn);
+            v->write("vOut", vOut);
+            v->write("vSend", vSend);
+            v->write("vPeak", vPeak);
+            v->write("vActive", vActive);
+            v->write("vActiveGain", vActiveGain);
 
             v->write("fInGain", fInGain);
             v->write("fOutGain", fOutGain);
-            v->write("fSendGain", fSendGain);
+            v->write("fOldOutGain", fOldOutGain);
+            v->write("bBypass", bBypass);
+            v->write("nBypassFade", nBypassFade);
+            v->write("nBypassTail", nBypassTail);
+            v->write("nBlockOffset", nBlockOffset);
+            v->write("nBlockSize", nBlockSize);
+            v->write("nDelay", nDelay);
+            v->write("bScrub", bScrub);
+            v->write("bGate", bGate);
+            v->write("bSidechain", bSidechain);
+            v->write("bGateSc", bGateSc);
+            v->write("fGateThresh", fGateThresh);
+            v->write("fGateAttack", fGateAttack);
+            v->write("fGateRelease", fGateRelease);
+            v->write("fGateFall", fGateFall);
+            v->write("fGateEnv", fGateEnv);
+            v->write("fGateGain", fGateGain);
+            v->write("nGateClosed", nGateClosed);
+            v->write("vGate", vGate);
+            v->write("bLoudness", bLoudness);
+            v->write("nLoudStep", nLoudStep);
+            v->write("nLoudPhase", nLoudPhase);
+            v->write("nLoudBlock", nLoudBlock);
+            v->writev("vKCoeff", vKCoeff, 10);
+            v->write("nConnected", nConnected);
+            v->write("nConnEvents", nConnEvents);
+            v->write("pFast", pFast != NULL);
 
             v->write("pBypass", pBypass);
             v->write("pInGain", pInGain);
             v->write("pOutGain", pOutGain);
-            v->write("pSendGain", pSendGain);
+            v->write("pDelayMode", pDelayMode);
+            v->write("pReportLatency", pReportLatency);
+            v->write("pScrub", pScrub);
+            v->write("pGate", pGate);
+            v->write("pGateSc", pGateSc);
+            v->write("pGateThresh", pGateThresh);
+            v->write("pGateAttack", pGateAttack);
+            v->write("pGateRelease", pGateRelease);
+            v->write("pGateMeter", pGateMeter);
+            v->write("pLoudness", pLoudness);
+            v->write("pConnected", pConnected);
+            v->write("pHistory", pHistory);
+
+        #if LSP_SEND_PROFILING
+            dump_profile(v, "sProfile", &sProfile);
+            dump_profile(v, "sWindow", &sWindow);
+            v->write("nProfilePeriod", nProfilePeriod);
+
+            v->write("pProfileMin", pProfileMin);
+            v->write("pProfileAvg", pProfileAvg);
+            v->write("pProfileMax", pProfileMax);
+        #endif /* LSP_SEND_PROFILING */
+
+            v->write("pData", pData);
         }
 
     } /* namespace plugins */
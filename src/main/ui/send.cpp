@@ -19,8 +19,14 @@
  * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <lsp-plug.in/common/debug.h>
 #include <lsp-plug.in/plug-fw/ui.h>
-#include <private/plugins/send.h>
+#include <lsp-plug.in/runtime/system.h>
+#include <private/meta/send.h>
+#include <private/ui/send.h>
+
+#include <math.h>
+#include <string.h>
 
 namespace lsp
 {
@@ -31,12 +37,157 @@ namespace lsp
         static const meta::plugin_t *plugin_uis[] =
         {
             &meta::send_mono,
-            &meta::send_stereo
+            &meta::send_stereo,
+            &meta::sc_send_mono,
+            &meta::sc_send_stereo,
+            &meta::send_5_1,
+            &meta::send_7_1,
+            &meta::send_x16,
+            &meta::multisend_mono,
+            &meta::multisend_stereo,
+            &meta::sc_multisend_mono,
+            &meta::sc_multisend_stereo,
+            &meta::send_return_mono,
+            &meta::send_return_stereo
         };
 
-        static ui::Factory factory(plugin_uis, 2);
+        static ui::Module *ui_factory(const meta::plugin_t *meta)
+        {
+            if ((meta == &meta::send_return_mono) || (meta == &meta::send_return_stereo))
+                return new ui::Module(meta);
+            return new send_ui(meta);
+        }
 
-    } /* namespace plugui */
-} /* namespace lsp */
+        static ui::Factory factory(ui_factory, plugin_uis, 13);
+
+        //---------------------------------------------------------------------
+        // Implementation
+        static constexpr float  METER_MIN_DB        = -72.0f;       // Lower limit of level meters (dB)
+        static constexpr float  METER_MAX_DB        = 24.0f;        // Upper limit of level meters (dB)
+        static constexpr float  METER_HOLD          = 1.0f;         // Time the peak is held (seconds)
+        static constexpr float  METER_FALL          = 20.0f;        // Fall rate of the level and the peak (dB/s)
+
+        send_ui::send_ui(const meta::plugin_t *meta):
+            ui::Module(meta)
+        {
+            pHistory        = NULL;
+            nFrameId        = 0;
+            nLastTime       = 0;
+        }
+
+        send_ui::~send_ui()
+        {
+            pHistory        = NULL;
+        }
+
+        status_t send_ui::post_init()
+        {
+            status_t res = ui::Module::post_init();
+            if (res != STATUS_OK)
+                return res;
+
+            // Level meters are written to the history stream in the same order as meter ports
+            for (const meta::port_t *p = pMetadata->ports; p->id != NULL; ++p)
+            {
+                if (p->role != meta::R_METER)
+                    continue;
+                if ((strncmp(p->id, "ilm", 3) != 0) && (strncmp(p->id, "slm", 3) != 0) && (strncmp(p->id, "olm", 3) != 0))
+                    continue;
+
+                meter_t *m          = vMeters.add();
+                if (m == NULL)
+                    return STATUS_NO_MEM;
+
+                m->wMeter           = pWrapper->controller()->widgets()->get<tk::LedMeterChannel>(p->id);
+                m->fValue           = METER_MIN_DB;
+                m->fPeak            = METER_MIN_DB;
+                m->fHold            = 0.0f;
+
+                if (m->wMeter != NULL)
+                {
+                    m->wMeter->value()->set_range(METER_MIN_DB, METER_MAX_DB);
+                    m->wMeter->value()->set(METER_MIN_DB);
+                    m->wMeter->peak()->set_range(METER_MIN_DB, METER_MAX_DB);
+                    m->wMeter->peak()->set(METER_MIN_DB);
+                }
+            }
 
+            pHistory        = pWrapper->port("mhist");
+            if (pHistory != NULL)
+                pHistory->bind(this);
+            nLastTime       = system::get_time_millis();
 
+            return STATUS_OK;
+        }
+
+        void send_ui::destroy()
+        {
+            if (pHistory != NULL)
+            {
+                pHistory->unbind(this);
+                pHistory        = NULL;
+            }
+            vMeters.flush();
+
+            ui::Module::destroy();
+        }
+
+        void send_ui::notify(ui::IPort *port, size_t /* flags */)
+        {
+            if ((port == NULL) || (port != pHistory))
+                return;
+
+            plug::stream_t *s   = pHistory->buffer<plug::stream_t>();
+            if (s != NULL)
+                update_meters(s);
+        }
+
+        void send_ui::update_meters(plug::stream_t *s)
+        {
+            const uint64_t now  = system::get_time_millis();
+            const float dt      = (now - nLastTime) * 0.001f;
+            const float fall    = METER_FALL * dt;
+            nLastTime           = now;
+
+            // Frames which are older than the stream capacity have been overwritten
+            const uint32_t last = s->frame_id();
+            const uint32_t num  = lsp_min(uint32_t(last - nFrameId), uint32_t(s->frames()));
+            const uint32_t head = last - num + 1;
+            nFrameId            = last;
+
+            for (size_t i=0, n=lsp_min(vMeters.size(), s->channels()); i<n; ++i)
+            {
+                meter_t *m          = vMeters.uget(i);
+
+                // Peak of all blocks processed since the previous update
+                float peak          = 0.0f;
+                for (uint32_t k=0; k<num; ++k)
+                {
+                    float v             = 0.0f;
+                    if (s->read_frame(head + k, i, &v, 0, 1) == 1)
+                        peak                = lsp_max(peak, v);
+                }
+                const float db      = (peak > 0.0f) ? lsp_max(20.0f * log10f(peak), METER_MIN_DB) : METER_MIN_DB;
+
+                // Level falls with the fixed rate, the peak is held first and then falls
+                m->fValue           = lsp_max(db, m->fValue - fall);
+                if (db >= m->fPeak)
+                {
+                    m->fPeak            = db;
+                    m->fHold            = METER_HOLD;
+                }
+                else if (m->fHold > 0.0f)
+                    m->fHold           -= dt;
+                else
+                    m->fPeak            = lsp_max(db, m->fPeak - fall);
+
+                if (m->wMeter != NULL)
+                {
+                    m->wMeter->value()->set(lsp_min(m->fValue, METER_MAX_DB));
+                    m->wMeter->peak()->set(lsp_min(m->fPeak, METER_MAX_DB));
+                }
+            }
+        }
+
+    } /* namespace plugui */
+} /* namespace lsp */
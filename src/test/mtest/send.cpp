@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/test-fw/mtest.h>
+#include <private/test/plugin.h>
+
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SAMPLE_RATE         48000
+#define SIGNAL_LENGTH       (SAMPLE_RATE * 60)
+#define BLOCK_SIZE          8192
+#define MAX_CHANNELS        2
+
+namespace
+{
+    using namespace lsp;
+    using send_test::PluginPort;
+
+    /**
+     * Stand-in for the consumer of the shared memory send: collects the send stream
+     * the same way a return does and stores it to the sample
+     */
+    class SendConsumer
+    {
+        private:
+            dspu::Sample        sData;
+            size_t              nOffset;
+
+        public:
+            SendConsumer()
+            {
+                nOffset     = 0;
+            }
+
+        public:
+            bool init(size_t channels, size_t length, size_t sample_rate)
+            {
+                if (!sData.init(channels, length, length))
+                    return false;
+                sData.set_sample_rate(sample_rate);
+                nOffset     = 0;
+                return true;
+            }
+
+            void consume(core::AudioBuffer *buf, size_t samples)
+            {
+                for (size_t i=0, n=sData.channels(); i<n; ++i)
+                {
+                    float *dst          = &sData.channel(i)[nOffset];
+                    if (buf[i].active())
+                        memcpy(dst, buf[i].buffer(), samples * sizeof(float));
+                    else
+                        memset(dst, 0, samples * sizeof(float));
+                }
+                nOffset    += samples;
+            }
+
+            const dspu::Sample *data() const        { return &sData;        }
+            ssize_t save(const char *path)          { return sData.save(path); }
+    };
+} /* namespace */
+
+MTEST_BEGIN("plugins", send)
+
+    void make_signal(dspu::Sample *s)
+    {
+        MTEST_ASSERT(s->init(MAX_CHANNELS, SIGNAL_LENGTH, SIGNAL_LENGTH));
+        s->set_sample_rate(SAMPLE_RATE);
+
+        // Logarithmic sweep from 20 Hz to 20 kHz, channels are shifted in phase
+        const float k   = logf(20000.0f / 20.0f);
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            float *dst      = s->channel(i);
+            for (size_t j=0; j<SIGNAL_LENGTH; ++j)
+            {
+                const float t   = float(j) / SIGNAL_LENGTH;
+                const float ph  = 2.0f * M_PI * 20.0f * SIGNAL_LENGTH / (SAMPLE_RATE * k) * (expf(k * t) - 1.0f);
+                dst[j]          = 0.5f * sinf(ph + i * M_PI * 0.5f);
+            }
+        }
+    }
+
+    void render(const dspu::Sample *in, size_t block)
+    {
+        const size_t channels   = in->channels();
+        const size_t length     = in->length();
+        const char *uid         = (channels == 1) ? "send_mono" : "send_stereo";
+
+        // Instantiate the plugin through the factory
+        plug::Module *plugin    = send_test::create_plugin(uid);
+        MTEST_ASSERT_MSG(plugin != NULL, "Failed to instantiate plugin %s", uid);
+
+        lltl::parray<plug::IPort> ports;
+        PluginPort *vIn[MAX_CHANNELS], *vOut[MAX_CHANNELS];
+        core::AudioBuffer vSend[MAX_CHANNELS];
+        size_t inputs = 0, outputs = 0, sends = 0;
+
+        for (const meta::port_t *p = plugin->metadata()->ports; p->id != NULL; ++p)
+        {
+            PluginPort *port    = new PluginPort(p);
+            MTEST_ASSERT(ports.add(port));
+
+            if (meta::is_audio_in_port(p))
+                vIn[inputs++]       = port;
+            else if (meta::is_audio_out_port(p))
+                vOut[outputs++]     = port;
+            else if (p->role == meta::R_AUDIO_SEND)
+                port->bind(&vSend[sends++]);
+        }
+        MTEST_ASSERT((inputs == channels) && (outputs == channels) && (sends == channels));
+
+        for (size_t i=0; i<sends; ++i)
+        {
+            MTEST_ASSERT(vSend[i].set_size(block));
+            vSend[i].set_active(true);
+        }
+
+        plugin->init(NULL, ports.array());
+        plugin->set_sample_rate(in->sample_rate());
+        plugin->update_settings();
+
+        // Prepare output and the send consumer
+        dspu::Sample out;
+        SendConsumer consumer;
+        MTEST_ASSERT(out.init(channels, length, length));
+        out.set_sample_rate(in->sample_rate());
+        MTEST_ASSERT(consumer.init(channels, length, in->sample_rate()));
+
+        // Stream the input through the plugin
+        const uint64_t start    = send_test::time_nanos();
+        for (size_t offset=0; offset < length; )
+        {
+            const size_t to_do      = lsp_min(length - offset, block);
+            for (size_t i=0; i<channels; ++i)
+            {
+                vIn[i]->bind(const_cast<dspu::Sample *>(in)->channel(i) + offset);
+                vOut[i]->bind(out.channel(i) + offset);
+            }
+
+            plugin->process(to_do);
+            consumer.consume(vSend, to_do);
+            offset                 += to_do;
+        }
+        const uint64_t time     = send_test::time_nanos() - start;
+
+        // Report throughput and deviation of the send stream from the input
+        const double seconds    = double(time) * 1e-9;
+        const double audio      = double(length) / in->sample_rate();
+        printf("Rendered %d samples x %d channels with block size %d in %.3f s: %.0f samples/s, %.1fx realtime\n",
+            int(length), int(channels), int(block), seconds, length / seconds, audio / seconds);
+
+        float deviation         = 0.0f;
+        for (size_t i=0; i<channels; ++i)
+        {
+            const float *a          = const_cast<dspu::Sample *>(in)->channel(i);
+            const float *b          = const_cast<dspu::Sample *>(consumer.data())->channel(i);
+            for (size_t j=0; j<length; ++j)
+                deviation               = lsp_max(deviation, fabsf(a[j] - b[j]));
+        }
+        printf("Maximum deviation of the send stream from the input: %g\n", deviation);
+
+        // Save the results
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "%s/%s-%s-out.wav", tempdir(), full_name(), uid);
+        printf("Saving output to %s\n", path);
+        MTEST_ASSERT(out.save(path) > 0);
+
+        snprintf(path, sizeof(path), "%s/%s-%s-send.wav", tempdir(), full_name(), uid);
+        printf("Saving send stream to %s\n", path);
+        MTEST_ASSERT(consumer.save(path) > 0);
+
+        plugin->destroy();
+        delete plugin;
+        for (size_t i=0, n=ports.size(); i<n; ++i)
+            delete ports.uget(i);
+        ports.flush();
+    }
+
+    MTEST_MAIN
+    {
+        // Arguments: [input file] [block size]
+        dspu::Sample in;
+        if (argc > 0)
+        {
+            printf("Loading %s\n", argv[0]);
+            MTEST_ASSERT(in.load(argv[0]) == STATUS_OK);
+        }
+        else
+            make_signal(&in);
+
+        MTEST_ASSERT_MSG((in.channels() >= 1) && (in.channels() <= MAX_CHANNELS),
+            "Only mono and stereo files are supported");
+
+        const size_t block = (argc > 1) ? size_t(atoi(argv[1])) : BLOCK_SIZE;
+        MTEST_ASSERT(block > 0);
+
+        render(&in, block);
+    }
+
+MTEST_END
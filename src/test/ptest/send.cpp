@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <private/test/plugin.h>
+
+#include <math.h>
+#include <string.h>
+
+#define SAMPLE_RATE         48000
+#define MIN_RANK            4
+#define MAX_RANK            13
+#define FRAME_SIZE          (1 << MAX_RANK)
+#define MAX_CHANNELS        16
+#define TIMED_FRAMES        64
+
+namespace
+{
+    using namespace lsp;
+    using send_test::PluginPort;
+
+    /**
+     * Plugin instance with all ports bound to the in-memory storage
+     */
+    typedef struct instance_t
+    {
+        plug::Module               *pPlugin;
+        lltl::parray<plug::IPort>   vPorts;
+        PluginPort                 *pBypass;
+        core::AudioBuffer           vSend[MAX_CHANNELS];
+    } instance_t;
+} /* namespace */
+
+PTEST_BEGIN("plugins", send, 5, 100)
+
+    bool init_instance(instance_t *inst, const char *uid, float *in, float *out)
+    {
+        inst->pPlugin       = send_test::create_plugin(uid);
+        inst->pBypass       = NULL;
+        if (inst->pPlugin == NULL)
+            return false;
+
+        const meta::plugin_t *meta = inst->pPlugin->metadata();
+        size_t inputs       = 0, outputs = 0, sends = 0;
+
+        for (const meta::port_t *p = meta->ports; p->id != NULL; ++p)
+        {
+            PluginPort *port    = new PluginPort(p);
+            if (!inst->vPorts.add(port))
+            {
+                delete port;
+                return false;
+            }
+
+            if (meta::is_audio_in_port(p))
+                port->bind(&in[FRAME_SIZE * (inputs++)]);
+            else if (meta::is_audio_out_port(p))
+                port->bind(&out[FRAME_SIZE * (outputs++)]);
+            else if (p->role == meta::R_AUDIO_SEND)
+                port->bind(&inst->vSend[sends++]);
+            else if (!strcmp(p->id, "bypass"))
+                inst->pBypass       = port;
+        }
+
+        for (size_t i=0; i<sends; ++i)
+            inst->vSend[i].set_size(FRAME_SIZE);
+        inst->pPlugin->init(NULL, inst->vPorts.array());
+        inst->pPlugin->set_sample_rate(SAMPLE_RATE);
+        inst->pPlugin->update_settings();
+
+        return true;
+    }
+
+    void destroy_instance(instance_t *inst)
+    {
+        if (inst->pPlugin != NULL)
+        {
+            inst->pPlugin->destroy();
+            delete inst->pPlugin;
+            inst->pPlugin       = NULL;
+        }
+
+        for (size_t i=0, n=inst->vPorts.size(); i<n; ++i)
+            delete inst->vPorts.uget(i);
+        inst->vPorts.flush();
+    }
+
+    void run_frame(plug::Module *plugin, size_t block)
+    {
+        for (size_t offset = 0; offset < FRAME_SIZE; offset += block)
+            plugin->process(block);
+    }
+
+    void call(const char *label, instance_t *inst, size_t block, bool active, bool bypass)
+    {
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            inst->vSend[i].set_active(active);
+        inst->pBypass->set_value((bypass) ? 1.0f : 0.0f);
+        inst->pPlugin->update_settings();
+
+        // Let the bypass crossfade settle
+        run_frame(inst->pPlugin, block);
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s x %d, send=%s, bypass=%s",
+            label, int(block), (active) ? "on" : "off", (bypass) ? "on" : "off");
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            run_frame(inst->pPlugin, block);
+        );
+
+        // Each frame contains the same number of samples regardless of the block size
+        const uint64_t start    = send_test::time_nanos();
+        for (size_t i=0; i<TIMED_FRAMES; ++i)
+            run_frame(inst->pPlugin, block);
+        const uint64_t time     = send_test::time_nanos() - start;
+        printf("%s: %.3f ns/sample\n", buf, double(time) / (TIMED_FRAMES * FRAME_SIZE));
+    }
+
+    void bench(const char *uid, float *in, float *out)
+    {
+        instance_t inst;
+        if ((!init_instance(&inst, uid, in, out)) || (inst.pBypass == NULL))
+        {
+            destroy_instance(&inst);
+            PTEST_FAIL_MSG("Failed to instantiate plugin %s", uid);
+            return;
+        }
+
+        for (size_t i=MIN_RANK; i <= MAX_RANK; ++i)
+        {
+            const size_t block  = 1 << i;
+
+            call(uid, &inst, block, true, false);
+            call(uid, &inst, block, true, true);
+            call(uid, &inst, block, false, false);
+            call(uid, &inst, block, false, true);
+
+            PTEST_SEPARATOR;
+        }
+
+        destroy_instance(&inst);
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data   = NULL;
+        float *in       = alloc_aligned<float>(data, FRAME_SIZE * MAX_CHANNELS * 2, 64);
+        float *out      = &in[FRAME_SIZE * MAX_CHANNELS];
+
+        for (size_t i=0; i < FRAME_SIZE * MAX_CHANNELS; ++i)
+            in[i]           = sinf(i * 0.01f);
+
+        bench("send_mono", in, out);
+        PTEST_SEPARATOR2;
+        bench("send_stereo", in, out);
+        PTEST_SEPARATOR2;
+        bench("sc_send_mono", in, out);
+        PTEST_SEPARATOR2;
+        bench("sc_send_stereo", in, out);
+        PTEST_SEPARATOR2;
+        bench("send_5_1", in, out);
+        PTEST_SEPARATOR2;
+        bench("send_7_1", in, out);
+        PTEST_SEPARATOR2;
+        bench("send_x16", in, out);
+        PTEST_SEPARATOR2;
+        bench("multisend_mono", in, out);
+        PTEST_SEPARATOR2;
+        bench("multisend_stereo", in, out);
+        PTEST_SEPARATOR2;
+        bench("sc_multisend_mono", in, out);
+        PTEST_SEPARATOR2;
+        bench("sc_multisend_stereo", in, out);
+
+        free_aligned(data);
+    }
+
+PTEST_END
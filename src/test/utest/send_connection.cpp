@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/lltl/parray.h>
+#include <lsp-plug.in/plug-fw/core/AudioBuffer.h>
+#include <lsp-plug.in/plug-fw/meta/func.h>
+#include <lsp-plug.in/plug-fw/plug.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <private/test/plugin.h>
+
+#include <math.h>
+
+#define SAMPLE_RATE         48000
+#define BLOCK_SIZE          256
+#define SETTLE_BLOCKS       64
+#define GUARD_VALUE         1234.5f
+
+namespace
+{
+    using namespace lsp;
+    using send_test::PluginPort;
+} /* namespace */
+
+UTEST_BEGIN("plugins", send_connection)
+
+    float send_peak(const float *buf)
+    {
+        float peak      = 0.0f;
+        for (size_t i=0; i<BLOCK_SIZE; ++i)
+            peak            = lsp_max(peak, fabsf(buf[i]));
+        return peak;
+    }
+
+    void run(plug::Module *plugin, size_t blocks)
+    {
+        for (size_t i=0; i<blocks; ++i)
+            plugin->process(BLOCK_SIZE);
+    }
+
+    UTEST_MAIN
+    {
+        // The wrapper toggles activity of the send buffer between blocks without
+        // updating settings, the plugin should follow the connection state anyway
+        plug::Module *plugin    = send_test::create_plugin("send_mono");
+        UTEST_ASSERT(plugin != NULL);
+
+        lltl::parray<plug::IPort> ports;
+        core::AudioBuffer send;
+        float in[BLOCK_SIZE], out[BLOCK_SIZE];
+        size_t sends = 0;
+
+        for (size_t i=0; i<BLOCK_SIZE; ++i)
+            in[i]           = 0.5f * sinf(i * 0.1f);
+
+        for (const meta::port_t *p = plugin->metadata()->ports; p->id != NULL; ++p)
+        {
+            PluginPort *port    = new PluginPort(p);
+            UTEST_ASSERT(ports.add(port));
+
+            if (meta::is_audio_in_port(p))
+                port->bind(in);
+            else if (meta::is_audio_out_port(p))
+                port->bind(out);
+            else if (p->role == meta::R_AUDIO_SEND)
+            {
+                port->bind(&send);
+                ++sends;
+            }
+        }
+        UTEST_ASSERT(sends == 1);
+
+        UTEST_ASSERT(send.set_size(BLOCK_SIZE));
+        send.set_active(false);
+
+        plugin->init(NULL, ports.array());
+        plugin->set_sample_rate(SAMPLE_RATE);
+        plugin->update_settings();
+        run(plugin, SETTLE_BLOCKS);
+
+        // Connect the send without updating settings
+        send.set_active(true);
+        run(plugin, SETTLE_BLOCKS);
+        UTEST_ASSERT_MSG(send_peak(send.buffer()) > 0.0f, "Send connected after update_settings() stays silent");
+
+        // Disconnect the send, the plugin should not write to the buffer anymore
+        send.set_active(false);
+        float *buf              = send.buffer();
+        for (size_t i=0; i<BLOCK_SIZE; ++i)
+            buf[i]                  = GUARD_VALUE;
+        run(plugin, SETTLE_BLOCKS);
+        for (size_t i=0; i<BLOCK_SIZE; ++i)
+        {
+            UTEST_ASSERT_MSG(buf[i] == GUARD_VALUE,
+                "Disconnected send buffer has been written at sample %d: %g", int(i), buf[i]);
+        }
+
+        plugin->destroy();
+        delete plugin;
+        for (size_t i=0, n=ports.size(); i<n; ++i)
+            delete ports.uget(i);
+        ports.flush();
+    }
+
+UTEST_END
@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-plugins-send
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-plugins-send is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-plugins-send is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-plugins-send. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/test-fw/utest.h>
+#include <private/dsp/send.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_COUNT           0x400
+#define MAX_SHIFT           4
+#define GUARD_SIZE          16
+#define BUF_SIZE            (MAX_COUNT + MAX_SHIFT + GUARD_SIZE)
+#define MAX_SENDS           3
+#define GUARD_VALUE         1234.5f
+
+namespace
+{
+    using namespace lsp;
+
+    // Lengths cover empty buffers, tails shorter than a vector and tails left after the unrolled loops
+    static const size_t lengths[] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 23, 31, 32, 33,
+        63, 64, 65, 127, 128, 129, 255, 1000, MAX_COUNT - 1, MAX_COUNT
+    };
+
+    // Non-finite values may differ in payload depending on the order of operands
+    inline bool same(float a, float b)
+    {
+        uint32_t ia, ib;
+        memcpy(&ia, &a, sizeof(ia));
+        memcpy(&ib, &b, sizeof(ib));
+        return (ia == ib) || ((isnan(a)) && (isnan(b)));
+    }
+
+    void fill_signal(float *dst, size_t count, bool special)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            dst[i]      = float(rand()) / float(RAND_MAX) * 2.0f - 1.0f;
+            if ((i % 7) == 3)
+                dst[i]      = (i & 1) ? 1e-40f : -1e-40f;
+            else if ((special) && ((i % 11) == 5))
+                dst[i]      = NAN;
+            else if ((special) && ((i % 13) == 6))
+                dst[i]      = (i & 1) ? INFINITY : -INFINITY;
+        }
+    }
+
+    void fill_guard(float *a, float *b, size_t count)
+    {
+        for (size_t i=0; i<count; ++i)
+        {
+            a[i]        = GUARD_VALUE;
+            b[i]        = GUARD_VALUE;
+        }
+    }
+} /* namespace */
+
+UTEST_BEGIN("plugins", send_dsp)
+
+    void check_buffers(const char *func, const float *a, const float *b, size_t count, size_t shift, bool special)
+    {
+        // The guard after the processed range detects writes beyond the buffer tail
+        for (size_t i=0; i<count + GUARD_SIZE; ++i)
+        {
+            UTEST_ASSERT_MSG(same(a[i], b[i]),
+                "%s: count=%d, shift=%d, special=%d: sample %d differs, generic=%g optimized=%g",
+                func, int(count), int(shift), int(special), int(i), a[i], b[i]);
+        }
+    }
+
+    void check_value(const char *func, float a, float b, size_t count, size_t shift)
+    {
+        UTEST_ASSERT_MSG(same(a, b),
+            "%s: count=%d, shift=%d: generic=%g optimized=%g",
+            func, int(count), int(shift), a, b);
+    }
+
+    void test_process(float **buf, size_t count, size_t shift, bool special)
+    {
+        float *src      = &buf[0][shift];
+        float *og       = &buf[1][shift];
+        float *os       = &buf[2][shift];
+        float *sg       = &buf[3][shift];
+        float *ss       = &buf[4][shift];
+
+        fill_signal(src, count, special);
+
+        fill_guard(og, os, count + GUARD_SIZE);
+        fill_guard(sg, ss, count + GUARD_SIZE);
+        const float pg  = send_dsp::generic::process(og, sg, src, 0.5f, -1.5f, count);
+        const float ps  = send_dsp::process(os, ss, src, 0.5f, -1.5f, count);
+        check_buffers("process out", og, os, count, shift, special);
+        check_buffers("process send", sg, ss, count, shift, special);
+        if (!special)
+            check_value("process peak", pg, ps, count, shift);
+
+        fill_guard(og, os, count + GUARD_SIZE);
+        const float pgn = send_dsp::generic::process(og, NULL, src, 2.0f, 0.0f, count);
+        const float psn = send_dsp::process(os, NULL, src, 2.0f, 0.0f, count);
+        check_buffers("process no send", og, os, count, shift, special);
+        if (!special)
+            check_value("process no send peak", pgn, psn, count, shift);
+    }
+
+    void test_process_inplace(float **buf, size_t count, size_t shift, bool special)
+    {
+        float *dg       = &buf[1][shift];
+        float *ds       = &buf[2][shift];
+        float *sg       = &buf[3][shift];
+        float *ss       = &buf[4][shift];
+
+        fill_guard(dg, ds, count + GUARD_SIZE);
+        fill_signal(dg, count, special);
+        memcpy(ds, dg, count * sizeof(float));
+
+        fill_guard(sg, ss, count + GUARD_SIZE);
+        const float pg  = send_dsp::generic::process_inplace(dg, sg, 0.25f, 3.0f, count);
+        const float ps  = send_dsp::process_inplace(ds, ss, 0.25f, 3.0f, count);
+        check_buffers("process_inplace out", dg, ds, count, shift, special);
+        check_buffers("process_inplace send", sg, ss, count, shift, special);
+        if (!special)
+            check_value("process_inplace peak", pg, ps, count, shift);
+
+        const float pgn = send_dsp::generic::process_inplace(dg, NULL, -1.0f, 0.0f, count);
+        const float psn = send_dsp::process_inplace(ds, NULL, -1.0f, 0.0f, count);
+        check_buffers("process_inplace no send", dg, ds, count, shift, special);
+        if (!special)
+            check_value("process_inplace no send peak", pgn, psn, count, shift);
+    }
+
+    void test_fanout(float **buf, size_t count, size_t shift, bool special)
+    {
+        static const float k_send[] = { 0.5f, -2.0f, 1e-3f };
+        float *src      = &buf[0][shift];
+        float *og       = &buf[1][shift];
+        float *os       = &buf[2][shift];
+        float *sg[MAX_SENDS], *ss[MAX_SENDS];
+
+        fill_signal(src, count, special);
+        fill_guard(og, os, count + GUARD_SIZE);
+        for (size_t j=0; j<MAX_SENDS; ++j)
+        {
+            sg[j]           = &buf[3 + j*2][shift];
+            ss[j]           = &buf[4 + j*2][shift];
+            fill_guard(sg[j], ss[j], count + GUARD_SIZE);
+        }
+
+        for (size_t n=1; n<=MAX_SENDS; ++n)
+        {
+            const float pg  = send_dsp::generic::fanout(og, sg, src, 0.75f, k_send, n, count);
+            const float ps  = send_dsp::fanout(os, ss, src, 0.75f, k_send, n, count);
+            check_buffers("fanout out", og, os, count, shift, special);
+            for (size_t j=0; j<n; ++j)
+                check_buffers("fanout send", sg[j], ss[j], count, shift, special);
+            if (!special)
+                check_value("fanout peak", pg, ps, count, shift);
+        }
+
+        // The output may alias the input
+        memcpy(os, og, count * sizeof(float));
+        const float pg  = send_dsp::generic::fanout(og, sg, og, 1.5f, k_send, MAX_SENDS, count);
+        const float ps  = send_dsp::fanout(os, ss, os, 1.5f, k_send, MAX_SENDS, count);
+        check_buffers("fanout in-place out", og, os, count, shift, special);
+        for (size_t j=0; j<MAX_SENDS; ++j)
+            check_buffers("fanout in-place send", sg[j], ss[j], count, shift, special);
+        if (!special)
+            check_value("fanout in-place peak", pg, ps, count, shift);
+    }
+
+    void test_matrix(float **buf, size_t count, size_t shift, bool special)
+    {
+        static const float m[] = { 0.75f, -0.25f, 0.125f, 1.5f };
+        float *l        = &buf[0][shift];
+        float *r        = &buf[9][shift];
+        float *lg       = &buf[1][shift];
+        float *ls       = &buf[2][shift];
+        float *rg       = &buf[3][shift];
+        float *rs       = &buf[4][shift];
+
+        fill_signal(l, count, special);
+        fill_signal(r, count, special);
+        fill_guard(lg, ls, count + GUARD_SIZE);
+        fill_guard(rg, rs, count + GUARD_SIZE);
+
+        send_dsp::generic::matrix(lg, rg, l, r, m, count);
+        send_dsp::matrix(ls, rs, l, r, m, count);
+        check_buffers("matrix left", lg, ls, count, shift, special);
+        check_buffers("matrix right", rg, rs, count, shift, special);
+    }
+
+    void test_mix_return(float **buf, size_t count, size_t shift, bool special)
+    {
+        float *dry      = &buf[0][shift];
+        float *ret      = &buf[9][shift];
+        float *og       = &buf[1][shift];
+        float *os       = &buf[2][shift];
+        float pg[3]     = { 0.125f, 0.25f, 0.5f };
+        float ps[3]     = { 0.125f, 0.25f, 0.5f };
+
+        fill_signal(dry, count, special);
+        fill_signal(ret, count, special);
+        fill_guard(og, os, count + GUARD_SIZE);
+
+        send_dsp::generic::mix_return(og, dry, ret, 0.5f, 2.0f, pg, count);
+        send_dsp::mix_return(os, dry, ret, 0.5f, 2.0f, ps, count);
+        check_buffers("mix_return", og, os, count, shift, special);
+        for (size_t k=0; (!special) && (k<3); ++k)
+            check_value("mix_return peak", pg[k], ps[k], count, shift);
+
+        // The output may alias the dry signal
+        memcpy(og, dry, count * sizeof(float));
+        memcpy(os, dry, count * sizeof(float));
+        send_dsp::generic::mix_return(og, og, ret, -1.0f, 0.5f, pg, count);
+        send_dsp::mix_return(os, os, ret, -1.0f, 0.5f, ps, count);
+        check_buffers("mix_return in-place", og, os, count, shift, special);
+        for (size_t k=0; (!special) && (k<3); ++k)
+            check_value("mix_return in-place peak", pg[k], ps[k], count, shift);
+    }
+
+    void test_sanitize(float **buf, size_t count, size_t shift, bool special)
+    {
+        float *dg       = &buf[1][shift];
+        float *ds       = &buf[2][shift];
+        size_t nfg = 1, dng = 2, nfs = 1, dns = 2;
+
+        fill_guard(dg, ds, count + GUARD_SIZE);
+        fill_signal(dg, count, special);
+        memcpy(ds, dg, count * sizeof(float));
+
+        send_dsp::generic::sanitize(dg, &nfg, &dng, count);
+        send_dsp::sanitize(ds, &nfs, &dns, count);
+        check_buffers("sanitize", dg, ds, count, shift, special);
+        UTEST_ASSERT_MSG((nfg == nfs) && (dng == dns),
+            "sanitize: count=%d, shift=%d: generic counters=%d/%d, optimized counters=%d/%d",
+            int(count), int(shift), int(nfg), int(dng), int(nfs), int(dns));
+
+        // All values are finite and normal after sanitizing
+        for (size_t i=0; i<count; ++i)
+        {
+            UTEST_ASSERT_MSG((isfinite(ds[i])) && ((ds[i] == 0.0f) || (fabsf(ds[i]) >= 1.17549435e-38f)),
+                "sanitize: count=%d, shift=%d: sample %d is not sanitized: %g",
+                int(count), int(shift), int(i), ds[i]);
+        }
+    }
+
+    void test_abs_max2(float **buf, size_t count, size_t shift, bool special)
+    {
+        float *src      = &buf[0][shift];
+        float *dg       = &buf[1][shift];
+        float *ds       = &buf[2][shift];
+
+        fill_signal(src, count, special);
+        fill_guard(dg, ds, count + GUARD_SIZE);
+        fill_signal(dg, count, false);
+        for (size_t i=0; i<count; ++i)
+            dg[i]           = fabsf(dg[i]);
+        memcpy(ds, dg, count * sizeof(float));
+
+        send_dsp::generic::abs_max2(dg, src, count);
+        send_dsp::abs_max2(ds, src, count);
+        check_buffers("abs_max2", dg, ds, count, shift, special);
+    }
+
+    UTEST_MAIN
+    {
+        void *data      = NULL;
+        float *buf[10];
+        float *ptr      = alloc_aligned<float>(data, BUF_SIZE * 10, 64);
+        UTEST_ASSERT(ptr != NULL);
+        for (size_t i=0; i<10; ++i)
+            buf[i]          = &ptr[BUF_SIZE * i];
+
+        srand(0);
+
+        for (size_t s=0; s<2; ++s)
+        {
+            const bool special  = s > 0;
+            for (size_t shift=0; shift<MAX_SHIFT; ++shift)
+            {
+                for (size_t i=0; i<sizeof(lengths)/sizeof(lengths[0]); ++i)
+                {
+                    const size_t count  = lengths[i];
+
+                    test_process(buf, count, shift, special);
+                    test_process_inplace(buf, count, shift, special);
+                    test_fanout(buf, count, shift, special);
+                    test_matrix(buf, count, shift, special);
+                    test_mix_return(buf, count, shift, special);
+                    test_sanitize(buf, count, shift, special);
+                    test_abs_max2(buf, count, shift, special);
+                }
+            }
+        }
+
+        free_aligned(data);
+    }
+
+UTEST_END